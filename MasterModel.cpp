@@ -6,12 +6,14 @@
 
 #include "helpers/mathHelper.h"
 #include "models/calcException.h"
+#include "models/credit/creditGoalSeek.h"
 #include "models/financeException.h"
 
 namespace  s21 {
 MasterModel::MasterModel() : mathModel(new MathModel), graphModel(new  GraphModel), creditModel(new CreditModel), depositModel(new DepositModel){}
 
 MasterModel::~MasterModel() {
+  graphWorker.Stop();
   delete mathModel;
   delete graphModel;
   delete creditModel;
@@ -29,6 +31,11 @@ void MasterModel::SetRadDegFactor(double value) {
 void MasterModel::SetX(double x) {
   mathModel->setX(x);
 }
+
+void MasterModel::SetSolveBegin(double a) { mathModel->setSolveBegin(a); }
+
+void MasterModel::SetSolveEnd(double b) { mathModel->setSolveEnd(b); }
+
 void MasterModel::ExpressionAdd(const char* add) {
   try {
     mathModel->ExpressionAddString(add);
@@ -52,6 +59,24 @@ void MasterModel::CalculateX() {
   }
 }
 
+void MasterModel::Solve() {
+  try {
+    mathModel->Solve();
+    AnnunciatorUpdateMathObservers();
+  } catch (const CalcException&) {
+    MathExceptionHandle();
+  }
+}
+
+void MasterModel::Integrate() {
+  try {
+    mathModel->Integrate();
+    AnnunciatorUpdateMathObservers();
+  } catch (const CalcException&) {
+    MathExceptionHandle();
+  }
+}
+
 double MasterModel::GetResult() {
   return mathModel->getResult();
 }
@@ -65,6 +90,13 @@ std::string MasterModel::GetExpression() {
 }
 
 bool MasterModel::IsCalc() { return mathModel->getIsCalc(); }
+double MasterModel::GetSolveBegin() { return mathModel->getSolveBegin(); }
+double MasterModel::GetSolveEnd() { return mathModel->getSolveEnd(); }
+std::vector<EquationRoot> MasterModel::GetRoots() {
+  return mathModel->getRoots();
+}
+bool MasterModel::IsIntegrated() { return mathModel->getIsIntegrated(); }
+IntegralResult MasterModel::GetIntegral() { return mathModel->getIntegral(); }
 void MasterModel::AddObserver(IObserverMathUpdate* observer) {mathAnnunciator.AddObserver(observer); }
 void MasterModel::RemoveObserver(IObserverMathUpdate* observer) {mathAnnunciator.RemoveObserver(observer); }
 void MasterModel::AddObserver(IObserverMathError* observer) {mathAnnunciator.AddObserver(observer);}
@@ -88,27 +120,88 @@ void MasterModel::SetBeginY(double newY) {
 void MasterModel::SetEndY(double newY) {
   graphModel->setYEnd(newY);
 }
+void MasterModel::SetBeginT(double newT) {
+  graphModel->setTBegin(newT);
+}
+void MasterModel::SetEndT(double newT) {
+  graphModel->setTEnd(newT);
+}
 void MasterModel::SetYScaleAuto(bool flag) {
   graphModel->setYScaleAuto(flag);
 }
 
-void MasterModel::CalculateGraph() {
-  try {
-    graphModel->CalculateGraph();
-    AnnunciatorUpdateGraphObservers();
-  } catch (const CalcException &) {
-    GraphExceptionHandle();
+void MasterModel::SetGraphType(IGraphType type) {
+  if (type == HeatmapPlot) {
+    graphModel->setPlotType(GraphModel::Heatmap);
+  } else if (type == ImplicitPlot) {
+    graphModel->setPlotType(GraphModel::Implicit);
+  } else if (type == ParametricPlot) {
+    graphModel->setPlotType(GraphModel::Parametric);
+  } else if (type == PolarPlot) {
+    graphModel->setPlotType(GraphModel::Polar);
+  } else {
+    graphModel->setPlotType(GraphModel::Explicit);
   }
+}
+
+void MasterModel::SetDerivativeOrder(int order) {
+  graphModel->setDerivativeOrder(order);
+}
+
+void MasterModel::SetMarkersEnabled(bool flag) {
+  graphModel->setMarkersEnabled(flag);
+}
 
+void MasterModel::CalculateGraph() {
+  auto task = std::make_unique<GraphModel>();
+  task->CopySettings(*graphModel);
+
+  graphWorker.Run(
+      std::move(task),
+      [this](std::shared_ptr<const GraphResult> result) {
+        PublishGraphResult(std::move(result));
+        AnnunciatorUpdateGraphObservers();
+      },
+      [this]() { GraphExceptionHandle(); });
+}
+
+void MasterModel::PublishGraphResult(
+    std::shared_ptr<const GraphResult> result) {
+  std::lock_guard<std::mutex> lock(graphResultMutex);
+  graphResult = std::move(result);
 }
 
 double MasterModel::GetXBegin() { return graphModel->getXBegin(); }
 double MasterModel::GetXEnd() { return graphModel->getXEnd(); }
 double MasterModel::GetYBegin() { return graphModel->getYBegin(); }
 double MasterModel::GetYEnd() { return graphModel->getYEnd(); }
+double MasterModel::GetTBegin() { return graphModel->getTBegin(); }
+double MasterModel::GetTEnd() { return graphModel->getTEnd(); }
 bool MasterModel::GetYScaleAuto() { return graphModel->getYScaleAuto(); }
-const std::vector<std::pair<double, double>>& MasterModel::GetPoints() {
-  return graphModel->getPoints();
+int MasterModel::GetDerivativeOrder() {
+  return graphModel->getDerivativeOrder();
+}
+bool MasterModel::GetMarkersEnabled() {
+  return graphModel->getMarkersEnabled();
+}
+IGraphType MasterModel::GetGraphType() {
+  GraphModel::PlotType res = graphModel->getPlotType();
+
+  if (res == GraphModel::Heatmap) {
+    return HeatmapPlot;
+  } else if (res == GraphModel::Implicit) {
+    return ImplicitPlot;
+  } else if (res == GraphModel::Parametric) {
+    return ParametricPlot;
+  } else if (res == GraphModel::Polar) {
+    return PolarPlot;
+  } else {
+    return ExplicitPlot;
+  }
+}
+std::shared_ptr<const GraphResult> MasterModel::GetGraphResult() {
+  std::lock_guard<std::mutex> lock(graphResultMutex);
+  return graphResult;
 }
 void MasterModel::AddObserver(IObserverGraphUpdate* observer) { graphAnnunciator.AddObserver(observer); }
 void MasterModel::RemoveObserver(IObserverGraphUpdate* observer) {graphAnnunciator.RemoveObserver(observer);}
@@ -127,6 +220,31 @@ void MasterModel::SetCreditType(ICreditType type) {
   }
 }
 
+void MasterModel::SetCreditRounding(bool roundPayments) {
+  if (roundPayments) {
+    creditModel->setRounding(CreditModel::RoundToKopecks);
+  } else {
+    creditModel->setRounding(CreditModel::Unrounded);
+  }
+}
+
+void MasterModel::AddCreditPrepayment(int month, double amount, int period,
+                                      bool reduceTerm) {
+  if (reduceTerm) {
+    creditModel->AddPrepayment(month, amount, period,
+                               CreditPrepayment::ReduceTerm);
+  } else {
+    creditModel->AddPrepayment(month, amount, period,
+                               CreditPrepayment::ReducePayment);
+  }
+}
+
+void MasterModel::AddCreditHoliday(int month, int length) {
+  creditModel->AddHoliday(month, length);
+}
+
+void MasterModel::ClearCreditEvents() { creditModel->ClearEvents(); }
+
 void MasterModel::CalculateCredit() {
   try {
     creditModel->CalculateCredit();
@@ -135,6 +253,55 @@ void MasterModel::CalculateCredit() {
     CreditExceptionHandle();
   }
 }
+
+void MasterModel::CalculateCreditGrid(double interestBegin, double interestEnd,
+                                      int rates, int monthsBegin,
+                                      int monthsEnd) {
+  try {
+    creditModel->CalculateGrid(interestBegin, interestEnd, rates, monthsBegin,
+                               monthsEnd);
+    AnnunciatorUpdateCreditObservers();
+  } catch (const FinanceException &) {
+    CreditExceptionHandle();
+  }
+}
+
+void MasterModel::SeekCreditInterest(double payment) {
+  try {
+    creditModel->setInterest(CreditGoalSeek::Interest(
+        creditModel->getSum(), creditModel->getMonths(), payment));
+    creditModel->setType(CreditModel::Annuity);
+    creditModel->CalculateCredit();
+    AnnunciatorUpdateCreditObservers();
+  } catch (const FinanceException &) {
+    CreditExceptionHandle();
+  }
+}
+
+void MasterModel::SeekCreditSum(double payment) {
+  try {
+    creditModel->setSum(CreditGoalSeek::Sum(
+        payment, creditModel->getMonths(), creditModel->getInterest()));
+    creditModel->setType(CreditModel::Annuity);
+    creditModel->CalculateCredit();
+    AnnunciatorUpdateCreditObservers();
+  } catch (const FinanceException &) {
+    CreditExceptionHandle();
+  }
+}
+
+void MasterModel::SeekCreditMonths(double payment) {
+  try {
+    creditModel->setMonths(CreditGoalSeek::Months(
+        creditModel->getSum(), payment, creditModel->getInterest()));
+    creditModel->setType(CreditModel::Annuity);
+    creditModel->CalculateCredit();
+    AnnunciatorUpdateCreditObservers();
+  } catch (const FinanceException &) {
+    CreditExceptionHandle();
+  }
+}
+
 double MasterModel::GetSum() { return creditModel->getSum(); }
 int MasterModel::GetMonths() { return creditModel->getMonths(); }
 double MasterModel::GetInterest() { return creditModel->getInterest(); }
@@ -148,12 +315,23 @@ ICreditType MasterModel::GetType() {
   }
 }
 
+bool MasterModel::GetCreditRounding() {
+  return creditModel->getRounding() == CreditModel::RoundToKopecks;
+}
+
 double MasterModel::GetMin() { return creditModel->getPaymentMin(); }
 double MasterModel::GetMax() { return creditModel->getPaymentMax(); }
 double MasterModel::GetOver() { return creditModel->getOverPayment(); }
 double MasterModel::GetTotal() { return creditModel->getTotalPayment(); }
+const CreditGrid& MasterModel::GetCreditGrid() { return creditModel->getGrid(); }
 bool MasterModel::IsCreditCalc() { return creditModel->getIsCalc(); }
 
+// График строится при первом запросе после расчета
+CreditSchedule MasterModel::GetSchedule() {
+  creditModel->CalculateSchedule();
+  return creditModel->getSchedule();
+}
+
 void MasterModel::AddObserver(IObserverCreditUpdate* observer) {creditAnnunciator.AddObserver(observer); }
 void MasterModel::RemoveObserver(IObserverCreditUpdate* observer) {creditAnnunciator.RemoveObserver(observer); }
 void MasterModel::AddObserver(IObserverCreditError* observer) {creditAnnunciator.AddObserver(observer);}
@@ -186,6 +364,14 @@ void MasterModel::SetDepositCapitalization(bool capitalization) {
   depositModel->setCapitalization(capitalization);
 }
 
+void MasterModel::SetDepositDailyAccrual(bool dailyAccrual) {
+  if (dailyAccrual) {
+    depositModel->setAccrual(DepositModel::PerDay);
+  } else {
+    depositModel->setAccrual(DepositModel::PerSpan);
+  }
+}
+
 void MasterModel::SetDepositDateStart(int year, int month, int day) {
   depositModel->setStartDate(year, month, day);
 }
@@ -200,6 +386,18 @@ void MasterModel::AddDepositOperationWithdrawal(int year, int month, int day,
   depositModel->AddOperation(year, month, day, -amount);
 }
 
+void MasterModel::ImportDepositOperations(const std::string& path) {
+  try {
+    depositModel->ImportOperations(path);
+  } catch (const FinanceException &) {
+    DepositExceptionHandle();
+  }
+}
+
+void MasterModel::ClearImportedDepositOperations() {
+  depositModel->ClearImportedOperations();
+}
+
 void MasterModel::ClearDepositOperationsList() {
   depositModel->ClearOperationsList();
 }
@@ -235,6 +433,13 @@ IDepositType MasterModel::GetDepositType() {
 
 
 bool MasterModel::GetDepositCapitalizationType() { return depositModel->getCapitalization(); }
+bool MasterModel::GetDepositDailyAccrual() {
+  return depositModel->getAccrual() == DepositModel::PerDay;
+}
+
+std::size_t MasterModel::GetImportedDepositOperationsCount() {
+  return depositModel->getImportedOperations().Size();
+}
 
 void MasterModel::AddObserver(IObserverDepositUpdate* observer) {depositAnnunciator.AddObserver(observer); }
 void MasterModel::RemoveObserver(IObserverDepositUpdate* observer) {depositAnnunciator.RemoveObserver(observer); }
@@ -259,6 +464,14 @@ void MasterModel::MathExceptionHandle() {
   } catch (const WrongOperatorException &) {
     AnnunciatorErrorMathObservers(
         {"wrong_operator", "Использован недопустимый оператор!"});
+  } catch (const WrongSolveRangeException &) {
+    AnnunciatorErrorMathObservers(
+        {"solve_range", "Начало отрезка \"a =\" должно быть меньше конца "
+                        "\"b =\"!"});
+  } catch (const WrongIntegralRangeException &) {
+    AnnunciatorErrorMathObservers(
+        {"solve_range", "Пределы интегрирования \"a =\" и \"b =\" должны "
+                        "быть конечными числами!"});
   } catch (const CalcException &) {
     AnnunciatorErrorMathObservers({"other", "Неизвестная ошибка!"});
   }
@@ -279,6 +492,12 @@ void MasterModel::GraphExceptionHandle() {
                         mathHelper::doubleToString(graphModel->_minY) +
                         " до " +
                         mathHelper::doubleToString(graphModel->_maxY)});
+  } catch (const WrongTGraphException &) {
+    AnnunciatorErrorGraphObservers(
+        {"tGraph", "t должно быть от " +
+                        mathHelper::doubleToString(graphModel->_minT) +
+                        " до " +
+                        mathHelper::doubleToString(graphModel->_maxT)});
   } catch (const InputZeroLengthException &) {
     AnnunciatorErrorGraphObservers(
         {"graphCalculation",
@@ -328,6 +547,26 @@ void MasterModel::CreditExceptionHandle() {
              " до " +
              mathHelper::doubleToString(creditModel->maxCreditInterest) +
              " (%)"});
+  } catch (const FinanceEventException &) {
+    AnnunciatorErrorCreditObservers(
+        {"events",
+         "Месяцы погашений и каникул должны быть от " +
+             mathHelper::doubleToString(creditModel->minCreditMonths) +
+             " до " +
+             mathHelper::doubleToString(creditModel->maxCreditMonths) +
+             ", суммы погашений - от " +
+             mathHelper::doubleToString(creditModel->minCreditSum) +
+             " до " +
+             mathHelper::doubleToString(creditModel->maxCreditSum) +
+             " (руб.)"});
+  } catch (const FinancePaymentException &) {
+    AnnunciatorErrorCreditObservers(
+        {"payment",
+         "Для такого платежа нет подходящего значения в допустимых "
+         "пределах"});
+  } catch (const FinanceOverflowException &) {
+    AnnunciatorErrorCreditObservers(
+        {"overflow", "Суммы расчета превышают допустимый предел"});
   } catch (const FinanceException &) {
     AnnunciatorErrorCreditObservers({"other", "Неизвестная ошибка"});
   }
@@ -415,6 +654,19 @@ void MasterModel::DepositExceptionHandle() {
     AnnunciatorErrorDepositObservers(
         {"operations_no_money",
          "Недостаточно денег на счете для совершения операции"});
+  } catch (const FinanceImportException &e) {
+    if (e.getLine() == 0) {
+      AnnunciatorErrorDepositObservers(
+          {"import", "Не удалось прочитать файл операций"});
+    } else {
+      AnnunciatorErrorDepositObservers(
+          {"import", "Строка " + std::to_string(e.getLine()) +
+                         " файла операций должна содержать дату и ненулевую "
+                         "сумму не больше чем с двумя знаками после запятой"});
+    }
+  } catch (const FinanceOverflowException &) {
+    AnnunciatorErrorDepositObservers(
+        {"overflow", "Сумма на вкладе превышает предел расчета"});
   } catch (const FinanceException &) {
     AnnunciatorErrorDepositObservers({"other", "Неизвестная ошибка"});
   }
@@ -5,6 +5,9 @@
 #ifndef SMARTCALCV2_MASTERMODEL_H
 #define SMARTCALCV2_MASTERMODEL_H
 
+#include <memory>
+#include <mutex>
+
 #include "helpers/annunciator.h"
 #include "interfaces/IMathModel.h"
 #include "interfaces/IDepositModel.h"
@@ -13,6 +16,7 @@
 #include "models/credit/creditModel.h" //TODO: поменять название
 #include "models/deposit/DepositModel.h"
 #include "models/graph/GraphModel.h"
+#include "models/graph/GraphWorker.h"
 #include "models/math/mathModel.h" //TODO: поменять название
 
 namespace s21 {
@@ -28,13 +32,22 @@ class MasterModel final : public IMathModel, public ICreditModel, public IDeposi
 
   void SetExpression(const std::string& newExp) override;
   void SetX(double x) override;
+  void SetSolveBegin(double a) override;
+  void SetSolveEnd(double b) override;
   void ExpressionAdd(const char* add) override;
   void ExpressionDeleteEnd() override;
   void CalculateX() override;
+  void Solve() override;
+  void Integrate() override;
   double GetResult() override;
   double GetX() override;
   std::string GetExpression() override;
   bool IsCalc() override;
+  double GetSolveBegin() override;
+  double GetSolveEnd() override;
+  std::vector<EquationRoot> GetRoots() override;
+  bool IsIntegrated() override;
+  IntegralResult GetIntegral() override;
   void AddObserver(IObserverMathUpdate* observer) override;
   void RemoveObserver(IObserverMathUpdate* observer) override;
   void AddObserver(IObserverMathError* observer) override;
@@ -45,14 +58,24 @@ class MasterModel final : public IMathModel, public ICreditModel, public IDeposi
   void SetEndX(double newX) override;
   void SetBeginY(double newY) override;
   void SetEndY(double newY) override;
+  void SetBeginT(double newT) override;
+  void SetEndT(double newT) override;
   void SetYScaleAuto(bool flag) override;
+  void SetGraphType(IGraphType type) override;
+  void SetDerivativeOrder(int order) override;
+  void SetMarkersEnabled(bool flag) override;
   void CalculateGraph() override;
   double GetXBegin() override;
   double GetXEnd() override;
   double GetYBegin() override;
   double GetYEnd() override;
+  double GetTBegin() override;
+  double GetTEnd() override;
   bool GetYScaleAuto() override;
-  const std::vector<std::pair<double, double>>& GetPoints() override;
+  IGraphType GetGraphType() override;
+  int GetDerivativeOrder() override;
+  bool GetMarkersEnabled() override;
+  std::shared_ptr<const GraphResult> GetGraphResult() override;
   void AddObserver(IObserverGraphUpdate* observer) override;
   void RemoveObserver(IObserverGraphUpdate* observer) override;
   void AddObserver(IObserverGraphError* observer) override;
@@ -62,15 +85,28 @@ class MasterModel final : public IMathModel, public ICreditModel, public IDeposi
   void SetCreditMonths(int months) override;
   void SetCreditInterest(double interest) override;
   void SetCreditType(ICreditType type) override;
+  void SetCreditRounding(bool roundPayments) override;
+  void AddCreditPrepayment(int month, double amount, int period,
+                           bool reduceTerm) override;
+  void AddCreditHoliday(int month, int length) override;
+  void ClearCreditEvents() override;
   void CalculateCredit() override;
+  void CalculateCreditGrid(double interestBegin, double interestEnd,
+                           int rates, int monthsBegin, int monthsEnd) override;
+  void SeekCreditInterest(double payment) override;
+  void SeekCreditSum(double payment) override;
+  void SeekCreditMonths(double payment) override;
   double GetSum() override;
   int GetMonths() override;
   double GetInterest() override;
   ICreditType GetType() override;
+  bool GetCreditRounding() override;
   double GetMin() override;
   double GetMax() override;
   double GetOver() override;
   double GetTotal() override;
+  CreditSchedule GetSchedule() override;
+  const CreditGrid& GetCreditGrid() override;
   bool IsCreditCalc() override;
   void AddObserver(IObserverCreditUpdate* observer) override;
   void RemoveObserver(IObserverCreditUpdate* observer) override;
@@ -83,11 +119,14 @@ class MasterModel final : public IMathModel, public ICreditModel, public IDeposi
   void SetDepositTax(double tax) override;
   void SetDepositPeriodicityType(IDepositType type) override;
   void SetDepositCapitalization(bool capitalization) override;
+  void SetDepositDailyAccrual(bool dailyAccrual) override;
   void SetDepositDateStart(int year, int month, int day) override;
   void AddDepositOperationReplenishment(int year, int month, int day,
                                                 double amount) override;
   void AddDepositOperationWithdrawal(int year, int month, int day,
                                              double amount) override;
+  void ImportDepositOperations(const std::string& path) override;
+  void ClearImportedDepositOperations() override;
   
   void ClearDepositOperationsList() override;
   void CalculateDeposit() override;
@@ -101,6 +140,8 @@ class MasterModel final : public IMathModel, public ICreditModel, public IDeposi
   double GetTax() override;
   IDepositType GetDepositType() override;
   bool GetDepositCapitalizationType() override;
+  bool GetDepositDailyAccrual() override;
+  std::size_t GetImportedDepositOperationsCount() override;
   
   void AddObserver(IObserverDepositUpdate* observer) override;
   void RemoveObserver(IObserverDepositUpdate* observer) override;
@@ -119,6 +160,10 @@ class MasterModel final : public IMathModel, public ICreditModel, public IDeposi
   Annunciator creditAnnunciator;
   Annunciator depositAnnunciator;
 
+  GraphWorker graphWorker;
+  std::mutex graphResultMutex;
+  std::shared_ptr<const GraphResult> graphResult;
+
   void MathExceptionHandle();
   void GraphExceptionHandle();
   void CreditExceptionHandle();
@@ -126,6 +171,7 @@ class MasterModel final : public IMathModel, public ICreditModel, public IDeposi
 
   void AnnunciatorUpdateMathObservers();
   void AnnunciatorErrorMathObservers(const std::pair<std::string, std::string>& error);
+  void PublishGraphResult(std::shared_ptr<const GraphResult> result);
   void AnnunciatorUpdateGraphObservers();
   void AnnunciatorErrorGraphObservers(const std::pair<std::string, std::string>& error);
   void AnnunciatorUpdateCreditObservers();
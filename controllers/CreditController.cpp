@@ -21,6 +21,40 @@ void CreditController::SetCreditType(int type) {
   _model->SetCreditType(static_cast<ICreditType>(type));
 }
 
+void CreditController::SetCreditRounding(bool roundPayments) {
+  _model->SetCreditRounding(roundPayments);
+}
+
+void CreditController::AddCreditPrepayment(int month, double amount,
+                                           int period, bool reduceTerm) {
+  _model->AddCreditPrepayment(month, amount, period, reduceTerm);
+}
+
+void CreditController::AddCreditHoliday(int month, int length) {
+  _model->AddCreditHoliday(month, length);
+}
+
+void CreditController::ClearCreditEvents() { _model->ClearCreditEvents(); }
+
 void CreditController::CalculateCredit() { _model->CalculateCredit(); }
 
+void CreditController::CalculateCreditGrid(double interestBegin,
+                                           double interestEnd, int rates,
+                                           int monthsBegin, int monthsEnd) {
+  _model->CalculateCreditGrid(interestBegin, interestEnd, rates, monthsBegin,
+                              monthsEnd);
+}
+
+void CreditController::SeekCreditInterest(double payment) {
+  _model->SeekCreditInterest(payment);
+}
+
+void CreditController::SeekCreditSum(double payment) {
+  _model->SeekCreditSum(payment);
+}
+
+void CreditController::SeekCreditMonths(double payment) {
+  _model->SeekCreditMonths(payment);
+}
+
 }  // namespace s21
\ No newline at end of file
@@ -24,8 +24,18 @@ class CreditController final : public ICreditController {
   void SetCreditMonths(int months) override;
   void SetCreditInterest(double interest) override;
   void SetCreditType(int type) override;
+  void SetCreditRounding(bool roundPayments) override;
+  void AddCreditPrepayment(int month, double amount, int period,
+                           bool reduceTerm) override;
+  void AddCreditHoliday(int month, int length) override;
+  void ClearCreditEvents() override;
 
   void CalculateCredit() override;
+  void CalculateCreditGrid(double interestBegin, double interestEnd,
+                           int rates, int monthsBegin, int monthsEnd) override;
+  void SeekCreditInterest(double payment) override;
+  void SeekCreditSum(double payment) override;
+  void SeekCreditMonths(double payment) override;
 
  private:
   ICreditModel* _model;
@@ -31,6 +31,10 @@ void DepositController::SetDepositCapitalization(bool capitalization) {
   _model->SetDepositCapitalization(capitalization);
 }
 
+void DepositController::SetDepositDailyAccrual(bool dailyAccrual) {
+  _model->SetDepositDailyAccrual(dailyAccrual);
+}
+
 void DepositController::SetDepositDateStart(int year, int month, int day) {
   _model->SetDepositDateStart(year, month, day);
 }
@@ -46,6 +50,14 @@ void DepositController::AddDepositOperationWithdrawal(int year, int month,
   _model->AddDepositOperationWithdrawal(year, month, day, amount);
 }
 
+void DepositController::ImportDepositOperations(const std::string &path) {
+  _model->ImportDepositOperations(path);
+}
+
+void DepositController::ClearImportedDepositOperations() {
+  _model->ClearImportedDepositOperations();
+}
+
 void DepositController::ClearDepositOperationsList() {
   _model->ClearDepositOperationsList();
 }
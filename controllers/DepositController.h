@@ -26,12 +26,16 @@ class DepositController final : public IDepositController {
   void SetDepositTax(double tax) override;
   void SetDepositPeriodicityType(int type) override;
   void SetDepositCapitalization(bool capitalization) override;
+  void SetDepositDailyAccrual(bool dailyAccrual) override;
   void SetDepositDateStart(int year, int month, int day) override;
   void AddDepositOperationReplenishment(int year, int month, int day,
                                         double amount) override;
   void AddDepositOperationWithdrawal(int year, int month, int day,
                                      double amount) override;
 
+  void ImportDepositOperations(const std::string& path) override;
+  void ClearImportedDepositOperations() override;
+
   void ClearDepositOperationsList() override;
   void CalculateDeposit() override;
 
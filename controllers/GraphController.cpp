@@ -19,7 +19,24 @@ void GraphController::SetBeginY(double newY) { _model->SetBeginY(newY); }
 
 void GraphController::SetEndY(double newY) { _model->SetEndY(newY); }
 
+void GraphController::SetBeginT(double newT) { _model->SetBeginT(newT); }
+
+void GraphController::SetEndT(double newT) { _model->SetEndT(newT); }
+
 void GraphController::SetYScaleAuto(bool flag) { _model->SetYScaleAuto(flag); }
+
+void GraphController::SetGraphType(int type) {
+  _model->SetGraphType(static_cast<IGraphType>(type));
+}
+
+void GraphController::SetDerivativeOrder(int order) {
+  _model->SetDerivativeOrder(order);
+}
+
+void GraphController::SetMarkersEnabled(bool flag) {
+  _model->SetMarkersEnabled(flag);
+}
+
 void GraphController::CalculateGraph() { _model->CalculateGraph(); }
 
 }  // namespace s21
\ No newline at end of file
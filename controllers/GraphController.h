@@ -27,7 +27,12 @@ class GraphController final : public IGraphController {
   void SetEndX(double newX) override;
   void SetBeginY(double newY) override;
   void SetEndY(double newY) override;
+  void SetBeginT(double newT) override;
+  void SetEndT(double newT) override;
   void SetYScaleAuto(bool flag) override;
+  void SetGraphType(int type) override;
+  void SetDerivativeOrder(int order) override;
+  void SetMarkersEnabled(bool flag) override;
 
   void CalculateGraph() override;
 
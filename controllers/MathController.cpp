@@ -10,11 +10,15 @@ void MathController::SetExpression(const QString &str) {
   _model->SetExpression(str.toStdString());  // из view в model
 }
 void MathController::SetX(double x) { _model->SetX(x); }
+void MathController::SetSolveBegin(double a) { _model->SetSolveBegin(a); }
+void MathController::SetSolveEnd(double b) { _model->SetSolveEnd(b); }
 void MathController::ExpressionAdd(const char *add) {
   _model->ExpressionAdd(add);
 }
 void MathController::ExpressionEraseEnd() { _model->ExpressionDeleteEnd(); }
 void MathController::CalculateX() { _model->CalculateX(); }
+void MathController::Solve() { _model->Solve(); }
+void MathController::Integrate() { _model->Integrate(); }
 void MathController::SetRadDegFactor(double value) {
   _model->SetRadDegFactor(value);
 }
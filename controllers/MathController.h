@@ -24,11 +24,15 @@ class MathController : public IMathController {
 
   void SetExpression(const QString& str) override;
   void SetX(double x) override;
+  void SetSolveBegin(double a) override;
+  void SetSolveEnd(double b) override;
   void ExpressionAdd(const char* add) override;
   void ExpressionEraseEnd() override;
   void SetRadDegFactor(double value) override;
 
   void CalculateX() override;
+  void Solve() override;
+  void Integrate() override;
  private:
   IMathModel* _model;
 };
@@ -11,6 +11,7 @@ namespace s21 {
  * \param observer Указатель на объект, реализующий интерфейс IObserverUpdate.
  */
 void Annunciator::AddObserver(s21::IObserverUpdate* observer) {
+  std::lock_guard<std::recursive_mutex> lock(observersMutex);
   updateObservers.push_back(observer);
 }
 
@@ -19,6 +20,7 @@ void Annunciator::AddObserver(s21::IObserverUpdate* observer) {
  * \param observer Указатель на объект, реализующий интерфейс IObserverUpdate.
  */
 void Annunciator::RemoveObserver(IObserverUpdate* observer) {
+  std::lock_guard<std::recursive_mutex> lock(observersMutex);
   updateObservers.remove(observer);
 }
 
@@ -27,6 +29,7 @@ void Annunciator::RemoveObserver(IObserverUpdate* observer) {
  * \param observer Указатель на объект, реализующий интерфейс IObserverError.
  */
 void Annunciator::AddObserver(s21::IObserverError* observer) {
+  std::lock_guard<std::recursive_mutex> lock(observersMutex);
   errorObservers.push_back(observer);
 }
 
@@ -35,13 +38,17 @@ void Annunciator::AddObserver(s21::IObserverError* observer) {
  * \param observer Указатель на объект, реализующий интерфейс IObserverError.
  */
 void Annunciator::RemoveObserver(IObserverError* observer) {
+  std::lock_guard<std::recursive_mutex> lock(observersMutex);
   errorObservers.remove(observer);
 }
 
 /**
  * \brief Уведомляет всех наблюдателей об обновлении.
+ * \note Список наблюдателей заблокирован на время уведомления, поэтому
+ * наблюдатель не может быть удален, пока его уведомляют из другого потока.
  */
 void Annunciator::UpdateObservers() {
+  std::lock_guard<std::recursive_mutex> lock(observersMutex);
   std::for_each(updateObservers.cbegin(), updateObservers.cend(),
                 [](IObserverUpdate* item) { item->Update(); });
 }
@@ -52,6 +59,7 @@ void Annunciator::UpdateObservers() {
  */
 void Annunciator::ErrorObservers(
     const std::pair<std::string, std::string>& error) {
+  std::lock_guard<std::recursive_mutex> lock(observersMutex);
   std::for_each(errorObservers.cbegin(), errorObservers.cend(),
                 [&error](IObserverError* item) { item->Error(error); });
 }
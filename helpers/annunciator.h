@@ -5,6 +5,7 @@
 #ifndef SMARTCALC_ANNUNCIATOR_H
 #define SMARTCALC_ANNUNCIATOR_H
 #include <list>
+#include <mutex>
 
 #include "../interfaces/observers/IObserver.h"
 
@@ -21,6 +22,8 @@ class Annunciator final {
   void ErrorObservers(const std::pair<std::string, std::string>& error);
 
  private:
+  // Наблюдатели могут уведомляться из рабочих потоков (расчет графика)
+  std::recursive_mutex observersMutex;
   std::list<IObserverUpdate*> updateObservers;
   std::list<IObserverError*> errorObservers;
 };
@@ -0,0 +1,192 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#include "contourHelper.h"
+
+#include <cmath>
+#include <unordered_map>
+
+namespace s21::contourHelper {
+
+namespace {
+
+// Углы на концах ребер ячейки: нижнего, правого, верхнего и левого
+const int edgeCorners[4][2] = {{0, 1}, {1, 2}, {3, 2}, {0, 3}};
+// Ребра, которые сходятся в углах ячейки
+const int cornerEdges[4][2] = {{0, 3}, {0, 1}, {1, 2}, {2, 3}};
+
+/**
+ * \brief Возвращает номер ребра ячейки в сетке.
+ *
+ * Горизонтальному ребру, которое начинается в узле, дается четный номер,
+ * вертикальному - нечетный, поэтому у соседних ячеек общее ребро имеет
+ * один номер.
+ */
+std::uint64_t EdgeIndex(const Cell& cell, int edge, std::size_t columns) {
+  std::uint64_t column = cell.column + (edge == 1 ? 1 : 0);
+  std::uint64_t row = cell.row + (edge == 2 ? 1 : 0);
+  std::uint64_t node = row * (columns + 1) + column;
+  return 2 * node + (edge % 2 == 0 ? 0 : 1);
+}
+
+/**
+ * \brief Находит точку пересечения линии уровня с ребром ячейки линейной
+ * интерполяцией значений в его концах.
+ */
+void EdgePoint(const Cell& cell, int edge, double& x, double& y) {
+  const double xs[4] = {cell.xLeft, cell.xRight, cell.xRight, cell.xLeft};
+  const double ys[4] = {cell.yBottom, cell.yBottom, cell.yTop, cell.yTop};
+  int a = edgeCorners[edge][0];
+  int b = edgeCorners[edge][1];
+  double t = cell.values[a] / (cell.values[a] - cell.values[b]);
+  x = xs[a] + (xs[b] - xs[a]) * t;
+  y = ys[a] + (ys[b] - ys[a]) * t;
+}
+
+void AddSegment(const Cell& cell, int from, int to, std::size_t columns,
+                std::vector<Segment>& segments) {
+  Segment segment;
+  segment.fromEdge = EdgeIndex(cell, from, columns);
+  segment.toEdge = EdgeIndex(cell, to, columns);
+  EdgePoint(cell, from, segment.x0, segment.y0);
+  EdgePoint(cell, to, segment.x1, segment.y1);
+  segments.push_back(segment);
+}
+
+}  // namespace
+
+/**
+ * \brief Находит отрезки нулевой линии уровня в ячейке методом marching
+ * squares.
+ *
+ * Линия уровня пересекает ребра, в концах которых значения функции разного
+ * знака. Если таких ребер четыре (седловая ячейка), неоднозначность
+ * разрешается по знаку среднего значения в центре ячейки. Ячейки, в углах
+ * которых функция не определена, пропускаются.
+ *
+ * \param cell Ячейка сетки со значениями функции в углах.
+ * \param columns Количество ячеек сетки по оси X, нужно для нумерации ребер.
+ * \param segments Вектор, в который добавляются найденные отрезки.
+ */
+void MarchSquare(const Cell& cell, std::size_t columns,
+                 std::vector<Segment>& segments) {
+  bool positive[4];
+
+  for (int corner = 0; corner < 4; ++corner) {
+    if (std::isnan(cell.values[corner]) || std::isinf(cell.values[corner])) {
+      return;
+    }
+
+    positive[corner] = cell.values[corner] > 0;
+  }
+
+  int edges[4];
+  int crossed = 0;
+
+  for (int edge = 0; edge < 4; ++edge) {
+    if (positive[edgeCorners[edge][0]] != positive[edgeCorners[edge][1]]) {
+      edges[crossed++] = edge;
+    }
+  }
+
+  if (crossed == 2) {
+    AddSegment(cell, edges[0], edges[1], columns, segments);
+  } else if (crossed == 4) {
+    double center = (cell.values[0] + cell.values[1] + cell.values[2] +
+                     cell.values[3]) /
+                    4;
+
+    // Отрезки отсекают углы, знак которых отличается от знака в центре
+    for (int corner = 0; corner < 4; ++corner) {
+      if (positive[corner] != (center > 0)) {
+        AddSegment(cell, cornerEdges[corner][0], cornerEdges[corner][1],
+                   columns, segments);
+      }
+    }
+  }
+}
+
+/**
+ * \brief Собирает отрезки линии уровня в ломаные.
+ *
+ * Соседние отрезки имеют общее ребро сетки, поэтому ломаные собираются по
+ * номерам ребер без сравнения координат. Каждая ломаная дописывается в
+ * выходные столбцы, а номер за ее последней точкой - в границы участков.
+ * Замкнутая ломаная заканчивается точкой, совпадающей с первой.
+ *
+ * \param segments Отрезки линии уровня.
+ * \param outXs Столбец, в который добавляются абсциссы.
+ * \param outYs Столбец, в который добавляются ординаты.
+ * \param outBounds Границы участков, в которые добавляется конец каждой
+ * ломаной.
+ */
+void ChainSegments(const std::vector<Segment>& segments,
+                   std::vector<double>& outXs, std::vector<double>& outYs,
+                   std::vector<std::size_t>& outBounds) {
+  std::unordered_multimap<std::uint64_t, std::size_t> edgeSegments;
+  edgeSegments.reserve(2 * segments.size());
+
+  for (std::size_t i = 0; i < segments.size(); ++i) {
+    edgeSegments.emplace(segments[i].fromEdge, i);
+    edgeSegments.emplace(segments[i].toEdge, i);
+  }
+
+  std::vector<bool> used(segments.size(), false);
+
+  // Проходит ломаную от ребра edge, пока есть неиспользованные отрезки
+  auto walk = [&](std::uint64_t edge, std::vector<double>& xs,
+                  std::vector<double>& ys) {
+    for (bool found = true; found;) {
+      found = false;
+      auto range = edgeSegments.equal_range(edge);
+
+      for (auto it = range.first; it != range.second && !found; ++it) {
+        if (used[it->second]) {
+          continue;
+        }
+
+        const Segment& next = segments[it->second];
+        used[it->second] = true;
+        found = true;
+
+        if (next.fromEdge == edge) {
+          xs.push_back(next.x1);
+          ys.push_back(next.y1);
+          edge = next.toEdge;
+        } else {
+          xs.push_back(next.x0);
+          ys.push_back(next.y0);
+          edge = next.fromEdge;
+        }
+      }
+    }
+  };
+
+  std::vector<double> backXs;
+  std::vector<double> backYs;
+  std::vector<double> forwardXs;
+  std::vector<double> forwardYs;
+
+  for (std::size_t i = 0; i < segments.size(); ++i) {
+    if (used[i]) {
+      continue;
+    }
+
+    used[i] = true;
+    backXs.assign(1, segments[i].x0);
+    backYs.assign(1, segments[i].y0);
+    forwardXs.assign(1, segments[i].x1);
+    forwardYs.assign(1, segments[i].y1);
+    walk(segments[i].toEdge, forwardXs, forwardYs);
+    walk(segments[i].fromEdge, backXs, backYs);
+
+    outXs.insert(outXs.end(), backXs.rbegin(), backXs.rend());
+    outYs.insert(outYs.end(), backYs.rbegin(), backYs.rend());
+    outXs.insert(outXs.end(), forwardXs.begin(), forwardXs.end());
+    outYs.insert(outYs.end(), forwardYs.begin(), forwardYs.end());
+    outBounds.push_back(outXs.size());
+  }
+}
+
+}  // namespace s21::contourHelper
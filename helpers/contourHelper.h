@@ -0,0 +1,45 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALC_CONTOURHELPER_H
+#define SMARTCALC_CONTOURHELPER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace s21::contourHelper {
+
+// Отрезок линии уровня внутри одной ячейки сетки. Концы отрезка лежат на
+// ребрах ячейки, ребро задается номером в сетке, общим для соседних ячеек
+struct Segment {
+  std::uint64_t fromEdge = 0;
+  std::uint64_t toEdge = 0;
+  double x0 = 0;
+  double y0 = 0;
+  double x1 = 0;
+  double y1 = 0;
+};
+
+// Ячейка сетки: номер левого нижнего узла, координаты границ и значения
+// функции в углах против часовой стрелки, начиная с левого нижнего
+struct Cell {
+  std::size_t column = 0;
+  std::size_t row = 0;
+  double xLeft = 0;
+  double xRight = 0;
+  double yBottom = 0;
+  double yTop = 0;
+  double values[4] = {0, 0, 0, 0};
+};
+
+void MarchSquare(const Cell& cell, std::size_t columns,
+                 std::vector<Segment>& segments);
+void ChainSegments(const std::vector<Segment>& segments,
+                   std::vector<double>& outXs, std::vector<double>& outYs,
+                   std::vector<std::size_t>& outBounds);
+
+}  // namespace s21::contourHelper
+
+#endif  // SMARTCALC_CONTOURHELPER_H
@@ -0,0 +1,184 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#include "decimationHelper.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace s21::decimationHelper {
+
+/**
+ * \brief Прореживает непрерывный участок графика перед отрисовкой.
+ *
+ * Точки участка [begin, end) прореживаются выбранным способом и дописываются
+ * в выходные столбцы. Если точек меньше, чем может дать прореживание, они
+ * копируются без изменений.
+ *
+ * \param xs Абсциссы точек, упорядоченные по возрастанию.
+ * \param ys Ординаты точек.
+ * \param begin Индекс первой точки участка.
+ * \param end Индекс за последней точкой участка.
+ * \param xBegin Начало видимого диапазона по оси X.
+ * \param xEnd Конец видимого диапазона по оси X.
+ * \param columns Ширина области графика в пикселях.
+ * \param outXs Столбец, в который добавляются абсциссы.
+ * \param outYs Столбец, в который добавляются ординаты.
+ * \param method Способ прореживания.
+ */
+void Decimate(const std::vector<double>& xs, const std::vector<double>& ys,
+              std::size_t begin, std::size_t end, double xBegin, double xEnd,
+              int columns, std::vector<double>& outXs,
+              std::vector<double>& outYs, Method method) {
+  if (begin >= end) {
+    return;
+  }
+
+  std::size_t limit = end - begin;
+
+  if (columns > 0 && xEnd > xBegin) {
+    double width = xs[end - 1] - xs[begin];
+    limit = static_cast<std::size_t>(
+        std::ceil(4.0 * columns * width / (xEnd - xBegin)));
+  }
+
+  if (end - begin <= limit + 4) {
+    outXs.insert(outXs.end(), xs.begin() + begin, xs.begin() + end);
+    outYs.insert(outYs.end(), ys.begin() + begin, ys.begin() + end);
+  } else if (method == Lttb) {
+    DecimateLttb(xs, ys, begin, end, std::max<std::size_t>(limit / 2, 3),
+                 outXs, outYs);
+  } else {
+    DecimateMinMax(xs, ys, begin, end, xBegin, xEnd, columns, outXs, outYs);
+  }
+}
+
+/**
+ * \brief Прореживает участок графика по столбцам пикселей.
+ *
+ * Для каждого столбца пикселей сохраняются первая, минимальная, максимальная
+ * и последняя точки в порядке следования, поэтому отрисованная ломаная
+ * визуально совпадает с исходной.
+ *
+ * \param xs Абсциссы точек.
+ * \param ys Ординаты точек.
+ * \param begin Индекс первой точки участка.
+ * \param end Индекс за последней точкой участка.
+ * \param xBegin Начало видимого диапазона по оси X.
+ * \param xEnd Конец видимого диапазона по оси X.
+ * \param columns Ширина области графика в пикселях.
+ * \param outXs Столбец, в который добавляются абсциссы.
+ * \param outYs Столбец, в который добавляются ординаты.
+ */
+void DecimateMinMax(const std::vector<double>& xs,
+                    const std::vector<double>& ys, std::size_t begin,
+                    std::size_t end, double xBegin, double xEnd, int columns,
+                    std::vector<double>& outXs, std::vector<double>& outYs) {
+  double scale = columns / (xEnd - xBegin);
+  std::size_t i = begin;
+
+  while (i < end) {
+    double column = std::floor((xs[i] - xBegin) * scale);
+    std::size_t indexes[4] = {i, i, i, i};  // первая, min, max, последняя
+
+    for (++i; i < end && std::floor((xs[i] - xBegin) * scale) == column; ++i) {
+      if (ys[i] < ys[indexes[1]]) {
+        indexes[1] = i;
+      }
+
+      if (ys[i] > ys[indexes[2]]) {
+        indexes[2] = i;
+      }
+
+      indexes[3] = i;
+    }
+
+    std::sort(indexes, indexes + 4);
+    auto last = std::unique(indexes, indexes + 4);
+
+    for (auto index = indexes; index != last; ++index) {
+      outXs.push_back(xs[*index]);
+      outYs.push_back(ys[*index]);
+    }
+  }
+}
+
+/**
+ * \brief Прореживает участок графика алгоритмом Largest-Triangle-Three-Buckets.
+ *
+ * Участок делится на `threshold - 2` корзины, из каждой выбирается точка,
+ * образующая треугольник наибольшей площади с выбранной точкой предыдущей
+ * корзины и средней точкой следующей. Крайние точки сохраняются всегда.
+ *
+ * \param xs Абсциссы точек.
+ * \param ys Ординаты точек.
+ * \param begin Индекс первой точки участка.
+ * \param end Индекс за последней точкой участка.
+ * \param threshold Количество точек после прореживания.
+ * \param outXs Столбец, в который добавляются абсциссы.
+ * \param outYs Столбец, в который добавляются ординаты.
+ */
+void DecimateLttb(const std::vector<double>& xs, const std::vector<double>& ys,
+                  std::size_t begin, std::size_t end, std::size_t threshold,
+                  std::vector<double>& outXs, std::vector<double>& outYs) {
+  std::size_t count = end - begin;
+
+  if (threshold >= count || threshold < 3) {
+    outXs.insert(outXs.end(), xs.begin() + begin, xs.begin() + end);
+    outYs.insert(outYs.end(), ys.begin() + begin, ys.begin() + end);
+    return;
+  }
+
+  double every = static_cast<double>(count - 2) / (threshold - 2);
+  std::size_t selected = begin;
+  outXs.push_back(xs[begin]);
+  outYs.push_back(ys[begin]);
+
+  for (std::size_t bucket = 0; bucket < threshold - 2; ++bucket) {
+    auto avgBegin = begin + static_cast<std::size_t>((bucket + 1) * every) + 1;
+    auto avgEnd = std::min(
+        begin + static_cast<std::size_t>((bucket + 2) * every) + 1, end);
+    double avgX = 0.0;
+    double avgY = 0.0;
+
+    for (std::size_t i = avgBegin; i < avgEnd; ++i) {
+      avgX += xs[i];
+      avgY += ys[i];
+    }
+
+    if (avgEnd > avgBegin) {
+      avgX /= static_cast<double>(avgEnd - avgBegin);
+      avgY /= static_cast<double>(avgEnd - avgBegin);
+    } else {
+      avgX = xs[end - 1];
+      avgY = ys[end - 1];
+    }
+
+    auto rangeBegin = begin + static_cast<std::size_t>(bucket * every) + 1;
+    auto rangeEnd = begin + static_cast<std::size_t>((bucket + 1) * every) + 1;
+    double ax = xs[selected];
+    double ay = ys[selected];
+    double maxArea = -1.0;
+    std::size_t maxIndex = rangeBegin;
+
+    for (std::size_t i = rangeBegin; i < rangeEnd && i < end; ++i) {
+      double area =
+          std::abs((ax - avgX) * (ys[i] - ay) - (ax - xs[i]) * (avgY - ay));
+
+      if (area > maxArea) {
+        maxArea = area;
+        maxIndex = i;
+      }
+    }
+
+    outXs.push_back(xs[maxIndex]);
+    outYs.push_back(ys[maxIndex]);
+    selected = maxIndex;
+  }
+
+  outXs.push_back(xs[end - 1]);
+  outYs.push_back(ys[end - 1]);
+}
+
+}  // namespace s21::decimationHelper
@@ -0,0 +1,32 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALC_DECIMATIONHELPER_H
+#define SMARTCALC_DECIMATIONHELPER_H
+
+#include <cstddef>
+#include <vector>
+
+namespace s21::decimationHelper {
+
+enum Method {
+  MinMax,  // первая, минимальная, максимальная и последняя точки столбца
+  Lttb,    // Largest-Triangle-Three-Buckets
+};
+
+void Decimate(const std::vector<double>& xs, const std::vector<double>& ys,
+              std::size_t begin, std::size_t end, double xBegin, double xEnd,
+              int columns, std::vector<double>& outXs,
+              std::vector<double>& outYs, Method method = MinMax);
+void DecimateMinMax(const std::vector<double>& xs,
+                    const std::vector<double>& ys, std::size_t begin,
+                    std::size_t end, double xBegin, double xEnd, int columns,
+                    std::vector<double>& outXs, std::vector<double>& outYs);
+void DecimateLttb(const std::vector<double>& xs, const std::vector<double>& ys,
+                  std::size_t begin, std::size_t end, std::size_t threshold,
+                  std::vector<double>& outXs, std::vector<double>& outYs);
+
+}  // namespace s21::decimationHelper
+
+#endif  // SMARTCALC_DECIMATIONHELPER_H
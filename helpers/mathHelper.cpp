@@ -4,7 +4,9 @@
 
 #include "mathHelper.h"
 
+#include <cassert>
 #include <cmath>
+#include <cstdint>
 
 namespace s21 {
 
@@ -59,15 +61,24 @@ std::string doubleToString(double value, int precision) {
   return RemoveTrailingZeros(result);
 }
 
+template <int N>
+struct Table {
+  constexpr Table() : t() {
+    t[0] = 1;
+    for (auto i = 1; i < N; ++i) t[i] = t[i - 1] * i;
+  }
+  std::uint64_t t[N];
+};
+
 /**
- * \brief Возвращает количество дней в указанном месяце заданного года.
- * \param month Месяц (1-12).
- * \param year Год.
- * \return Количество дней в указанном месяце заданного года.
+ * \brief Возвращает факториал целой части числа по таблице.
+ * \param value Неотрицательное число.
+ * \return Факториал целой части числа или 0, если число не меньше 66.
  */
-int GetDaysCount(int month, int year) {
-  return 31 - (102 / month & 1) -
-         ((4 / month & 2) >> (!(year % 4) - !(year % 100) + !(year % 400)));
+double Factorial(double value) {
+  constexpr auto table = Table<66>();
+  assert(value >= 0);
+  return value < 66 ? static_cast<double>(table.t[static_cast<int>(value)]) : 0;
 }
 
 }  // namespace s21::mathHelpers
@@ -13,7 +13,7 @@ double Round(double value, int precision);
 std::string intToString(int value);
 std::string doubleToString(double value, int precision = 2);
 std::string RemoveTrailingZeros(const std::string& input);
-int GetDaysCount(int month, int year);
+double Factorial(double value);
 }
 }  // namespace s21::mathHelper
 
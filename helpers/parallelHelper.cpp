@@ -0,0 +1,178 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#include "parallelHelper.h"
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace s21::parallelHelper {
+
+namespace {
+
+/**
+ * \brief Общий пул потоков, который живет до конца программы.
+ *
+ * Потоки создаются при первом параллельном расчете, поэтому повторные
+ * расчеты - кадры тепловой карты, пересчет сетки кредита при движении
+ * ползунков - не тратят время на создание и завершение потоков.
+ */
+class ThreadPool final {
+ public:
+  ThreadPool(const ThreadPool& other) = delete;
+  ThreadPool(ThreadPool&& other) = delete;
+  ThreadPool& operator=(const ThreadPool& other) = delete;
+  ThreadPool& operator=(ThreadPool&& other) = delete;
+
+  static ThreadPool& Instance() {
+    static ThreadPool pool;
+    return pool;
+  }
+
+  [[nodiscard]] std::size_t Size() const noexcept { return threads.size(); }
+
+  void Submit(std::size_t count, const std::function<void()>& task) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      tasks.insert(tasks.end(), count, task);
+    }
+
+    if (count == 1) {
+      available.notify_one();
+    } else {
+      available.notify_all();
+    }
+  }
+
+ private:
+  ThreadPool() {
+    unsigned count = ThreadsCount() - 1;
+    threads.reserve(count);
+
+    for (unsigned i = 0; i < count; ++i) {
+      threads.emplace_back([this]() { Loop(); });
+    }
+  }
+
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+
+    available.notify_all();
+
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+  }
+
+  void Loop() {
+    while (true) {
+      std::function<void()> task;
+
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        available.wait(lock, [this]() { return stopping || !tasks.empty(); });
+
+        if (stopping) {
+          return;
+        }
+
+        task = std::move(tasks.front());
+        tasks.pop_front();
+      }
+
+      task();
+    }
+  }
+
+  std::mutex mutex;
+  std::condition_variable available;
+  std::deque<std::function<void()>> tasks;
+  std::vector<std::thread> threads;
+  bool stopping = false;
+};
+
+// Состояние одного вызова RunOnPool. Живет, пока его задачи стоят в очереди
+// пула, даже если вызов уже завершился
+struct PoolJob {
+  std::mutex mutex;
+  std::condition_variable finished;
+  const std::function<void()>* task = nullptr;
+  std::size_t running = 0;
+  bool closed = false;
+};
+
+}  // namespace
+
+/**
+ * \brief Возвращает количество потоков для параллельного расчета.
+ * \param requested Запрошенное количество потоков, 0 - по числу ядер.
+ * \return Количество потоков, не меньше одного.
+ * \note Не выбрасывает исключения.
+ */
+unsigned ThreadsCount(unsigned requested) noexcept {
+  if (requested > 0) {
+    return requested;
+  }
+
+  unsigned hardware = std::thread::hardware_concurrency();
+  return hardware > 0 ? hardware : 1;
+}
+
+/**
+ * \brief Выполняет задачу в вызывающем потоке и еще не больше чем в
+ * `helpers` потоках общего пула.
+ *
+ * Вызывающий поток не ждет свободных потоков пула: когда его собственный
+ * вызов задачи завершается, задачи, которые пул еще не начал, отменяются, и
+ * ожидаются только уже начатые. Поэтому вложенные и одновременные расчеты
+ * из разных потоков не блокируют друг друга, а в худшем случае выполняются
+ * одним вызывающим потоком.
+ *
+ * \param helpers Количество дополнительных вызовов задачи в потоках пула,
+ * не больше количества потоков пула - числа ядер без одного.
+ * \param task Задача. Должна сама делить работу между своими вызовами и не
+ * выбрасывать исключений.
+ */
+void RunOnPool(std::size_t helpers, const std::function<void()>& task) {
+  ThreadPool& pool = ThreadPool::Instance();
+  auto job = std::make_shared<PoolJob>();
+  job->task = &task;
+  helpers = std::min(helpers, pool.Size());
+
+  if (helpers > 0) {
+    pool.Submit(helpers, [job]() {
+      {
+        std::lock_guard<std::mutex> lock(job->mutex);
+
+        if (job->closed) {
+          return;
+        }
+
+        ++job->running;
+      }
+
+      (*job->task)();
+
+      std::lock_guard<std::mutex> lock(job->mutex);
+
+      if (--job->running == 0) {
+        job->finished.notify_one();
+      }
+    });
+  }
+
+  task();
+
+  std::unique_lock<std::mutex> lock(job->mutex);
+  job->closed = true;
+  job->finished.wait(lock, [&job]() { return job->running == 0; });
+}
+
+}  // namespace s21::parallelHelper
@@ -0,0 +1,84 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALC_PARALLELHELPER_H
+#define SMARTCALC_PARALLELHELPER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+
+namespace s21::parallelHelper {
+
+unsigned ThreadsCount(unsigned requested = 0) noexcept;
+void RunOnPool(std::size_t helpers, const std::function<void()>& task);
+
+/**
+ * \brief Выполняет функцию над диапазоном индексов [0, count) в нескольких
+ * потоках.
+ *
+ * Диапазон делится на блоки по `grain` индексов, потоки забирают блоки по
+ * очереди, поэтому неравномерная нагрузка распределяется автоматически.
+ * Блоки обрабатывают вызывающий поток и потоки общего пула, см. RunOnPool,
+ * поэтому вызов не создает новых потоков.
+ * Функция вызывается как `function(begin, end)` для каждого блока. Первое
+ * исключение, выброшенное в любом потоке, останавливает выдачу блоков и
+ * перебрасывается в вызывающий поток.
+ *
+ * \param count Количество индексов.
+ * \param grain Количество индексов в блоке.
+ * \param function Обработчик блока индексов.
+ * \param threads Количество потоков, 0 - по числу ядер. Больше числа ядер
+ * потоков не бывает.
+ */
+template <class Function>
+void ParallelFor(std::size_t count, std::size_t grain, Function function,
+                 unsigned threads = 0) {
+  grain = std::max<std::size_t>(grain, 1);
+  std::size_t blocks = (count + grain - 1) / grain;
+  auto workers = static_cast<std::size_t>(ThreadsCount(threads));
+  workers = std::min(workers, blocks);
+
+  if (workers <= 1) {
+    for (std::size_t begin = 0; begin < count; begin += grain) {
+      function(begin, std::min(begin + grain, count));
+    }
+
+    return;
+  }
+
+  std::atomic<std::size_t> nextBlock{0};
+  std::exception_ptr error;
+  std::mutex errorMutex;
+
+  std::function<void()> worker = [&]() {
+    for (std::size_t block = nextBlock++; block < blocks; block = nextBlock++) {
+      try {
+        std::size_t begin = block * grain;
+        function(begin, std::min(begin + grain, count));
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(errorMutex);
+
+        if (!error) {
+          error = std::current_exception();
+        }
+
+        nextBlock = blocks;
+      }
+    }
+  };
+
+  RunOnPool(workers - 1, worker);
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+}  // namespace s21::parallelHelper
+
+#endif  // SMARTCALC_PARALLELHELPER_H
@@ -0,0 +1,203 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALC_ROOTHELPER_H
+#define SMARTCALC_ROOTHELPER_H
+
+#include <cmath>
+#include <limits>
+
+namespace s21::rootHelper {
+
+/**
+ * \brief Уточняет корень функции на отрезке методом Брента.
+ *
+ * На концах отрезка функция должна иметь значения разных знаков. Метод
+ * сочетает обратную квадратичную интерполяцию, секущие и деление пополам:
+ * сходится сверхлинейно на гладких функциях и не хуже деления пополам на
+ * остальных.
+ *
+ * \param function Функция double(double).
+ * \param a Левый конец отрезка.
+ * \param b Правый конец отрезка.
+ * \param fa Значение функции в a.
+ * \param fb Значение функции в b.
+ * \param tolerance Допустимая погрешность корня по аргументу.
+ * \param maxIterations Максимальное количество вычислений функции.
+ * \return Корень или NaN, если функция на отрезке не определена.
+ */
+template <class Function>
+double BrentRoot(Function function, double a, double b, double fa, double fb,
+                 double tolerance, int maxIterations = 100) {
+  if (fa == 0) {
+    return a;
+  }
+
+  if (fb == 0) {
+    return b;
+  }
+
+  const double epsilon = std::numeric_limits<double>::epsilon();
+  double c = b;
+  double fc = fb;
+  double d = b - a;
+  double e = d;
+
+  for (int i = 0; i < maxIterations; ++i) {
+    if (std::isnan(fb)) {
+      return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    // c - точка с противоположным знаком, корень лежит между b и c
+    if ((fb > 0) == (fc > 0)) {
+      c = a;
+      fc = fa;
+      d = b - a;
+      e = d;
+    }
+
+    // b - лучшее приближение
+    if (std::abs(fc) < std::abs(fb)) {
+      a = b;
+      b = c;
+      c = a;
+      fa = fb;
+      fb = fc;
+      fc = fa;
+    }
+
+    double tol = 2 * epsilon * std::abs(b) + tolerance / 2;
+    double middle = (c - b) / 2;
+
+    if (std::abs(middle) <= tol || fb == 0) {
+      return b;
+    }
+
+    if (std::abs(e) >= tol && std::abs(fa) > std::abs(fb)) {
+      double s = fb / fa;
+      double p;
+      double q;
+
+      if (a == c) {
+        p = 2 * middle * s;
+        q = 1 - s;
+      } else {
+        double r = fb / fc;
+        q = fa / fc;
+        p = s * (2 * middle * q * (q - r) - (b - a) * (r - 1));
+        q = (q - 1) * (r - 1) * (s - 1);
+      }
+
+      if (p > 0) {
+        q = -q;
+      } else {
+        p = -p;
+      }
+
+      // Интерполяция принимается, только если шаг остается внутри отрезка
+      // и уменьшается достаточно быстро, иначе отрезок делится пополам
+      if (2 * p < std::fmin(3 * middle * q - std::abs(tol * q),
+                            std::abs(e * q))) {
+        e = d;
+        d = p / q;
+      } else {
+        d = middle;
+        e = d;
+      }
+    } else {
+      d = middle;
+      e = d;
+    }
+
+    a = b;
+    fa = fb;
+    b += std::abs(d) > tol ? d : std::copysign(tol, middle);
+    fb = function(b);
+  }
+
+  return b;
+}
+
+/**
+ * \brief Уточняет корень функции на отрезке методом Ньютона с защитой
+ * делением пополам.
+ *
+ * Отрезок со сменой знака сохраняется на каждом шаге. Если шаг Ньютона
+ * выходит за отрезок, уменьшает невязку слишком медленно или производная не
+ * определена, отрезок делится пополам, поэтому метод сходится всегда, а на
+ * гладких функциях - квадратично.
+ *
+ * \param function Функция double(double x, double& slope), возвращающая
+ * значение в x и записывающая производную в slope.
+ * \param a Левый конец отрезка.
+ * \param b Правый конец отрезка.
+ * \param fa Значение функции в a.
+ * \param fb Значение функции в b.
+ * \param tolerance Допустимая погрешность корня по аргументу.
+ * \param maxIterations Максимальное количество вычислений функции.
+ * \return Корень или NaN, если функция на отрезке не определена.
+ */
+template <class Function>
+double NewtonRoot(Function function, double a, double b, double fa, double fb,
+                  double tolerance, int maxIterations = 100) {
+  if (fa == 0) {
+    return a;
+  }
+
+  if (fb == 0) {
+    return b;
+  }
+
+  const double epsilon = std::numeric_limits<double>::epsilon();
+  // Функция отрицательна в low и положительна в high
+  double low = fa < 0 ? a : b;
+  double high = fa < 0 ? b : a;
+  double x = (a + b) / 2;
+  double step = std::abs(b - a);
+  double lastStep = step;
+  double slope = 0;
+  double value = function(x, slope);
+
+  for (int i = 0; i < maxIterations; ++i) {
+    if (std::isnan(value)) {
+      return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    if (value == 0) {
+      return x;
+    }
+
+    if (value < 0) {
+      low = x;
+    } else {
+      high = x;
+    }
+
+    bool outside =
+        ((x - high) * slope - value) * ((x - low) * slope - value) > 0;
+    bool slow = std::abs(2 * value) > std::abs(lastStep * slope);
+
+    if (!std::isfinite(slope) || slope == 0 || outside || slow) {
+      lastStep = step;
+      step = (high - low) / 2;
+      x = low + step;
+    } else {
+      lastStep = step;
+      step = value / slope;
+      x -= step;
+    }
+
+    if (std::abs(step) <= tolerance / 2 + 2 * epsilon * std::abs(x)) {
+      return x;
+    }
+
+    value = function(x, slope);
+  }
+
+  return x;
+}
+
+}  // namespace s21::rootHelper
+
+#endif  // SMARTCALC_ROOTHELPER_H
@@ -21,4 +21,29 @@ void TrimLeft(std::string_view& str) noexcept {
 
   str.remove_prefix(i);
 }
+
+/**
+ * \brief Разбивает строку на части по символу-разделителю.
+ * \param str Исходная строка.
+ * \param delimiter Символ-разделитель.
+ * \return Части строки без разделителей. Части, состоящие только из
+ * пробельных символов, пропускаются.
+ */
+std::vector<std::string> Split(std::string_view str, char delimiter) {
+  std::vector<std::string> parts;
+
+  while (!str.empty()) {
+    std::size_t end = str.find(delimiter);
+    std::string_view part = str.substr(0, end);
+    TrimLeft(part);
+
+    if (!part.empty()) {
+      parts.emplace_back(part);
+    }
+
+    str.remove_prefix(end == std::string_view::npos ? str.size() : end + 1);
+  }
+
+  return parts;
+}
 }  // namespace s21::stringHelper
\ No newline at end of file
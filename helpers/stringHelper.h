@@ -5,10 +5,13 @@
 #ifndef SMARTCALC_STRINGHELPER_H
 #define SMARTCALC_STRINGHELPER_H
 
+#include <string>
 #include <string_view>
+#include <vector>
 
 namespace s21::stringHelper {
 void TrimLeft(std::string_view& str) noexcept;
+std::vector<std::string> Split(std::string_view str, char delimiter);
 }
 
 #endif  // SMARTCALC_STRINGHELPER_H
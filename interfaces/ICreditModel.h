@@ -15,8 +15,19 @@ class ICreditModel : public ICreditModelPublic {
   virtual void SetCreditMonths(int months) = 0;
   virtual void SetCreditInterest(double interest) = 0;
   virtual void SetCreditType(ICreditType type) = 0;
+  virtual void SetCreditRounding(bool roundPayments) = 0;
+  virtual void AddCreditPrepayment(int month, double amount, int period,
+                                   bool reduceTerm) = 0;
+  virtual void AddCreditHoliday(int month, int length) = 0;
+  virtual void ClearCreditEvents() = 0;
 
   virtual void CalculateCredit() = 0;
+  virtual void CalculateCreditGrid(double interestBegin, double interestEnd,
+                                   int rates, int monthsBegin,
+                                   int monthsEnd) = 0;
+  virtual void SeekCreditInterest(double payment) = 0;
+  virtual void SeekCreditSum(double payment) = 0;
+  virtual void SeekCreditMonths(double payment) = 0;
 };
 }  // namespace s21
 
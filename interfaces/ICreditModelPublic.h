@@ -7,6 +7,8 @@
 
 #include <string>
 
+#include "../models/credit/creditGrid.h"
+#include "../models/credit/creditSchedule.h"
 #include "observers/IObserverCredit.h"
 
 namespace s21 {
@@ -23,10 +25,13 @@ class ICreditModelPublic {
   virtual int GetMonths() = 0;
   virtual double GetInterest() = 0;
   virtual ICreditType GetType() = 0;
+  virtual bool GetCreditRounding() = 0;
   virtual double GetMin() = 0;
   virtual double GetMax() = 0;
   virtual double GetOver() = 0;
   virtual double GetTotal() = 0;
+  virtual CreditSchedule GetSchedule() = 0;
+  virtual const CreditGrid& GetCreditGrid() = 0;
   virtual bool IsCreditCalc() = 0;
 
   virtual void AddObserver(IObserverCreditUpdate* observer) = 0;
@@ -6,6 +6,7 @@
 #define SMARTCALC_IDEPOSITCONTROLLER_H
 
 #include <QString>
+#include <string>
 
 namespace s21 {
 
@@ -19,12 +20,16 @@ class IDepositController {
   virtual void SetDepositTax(double tax) = 0;
   virtual void SetDepositPeriodicityType(int type) = 0;
   virtual void SetDepositCapitalization(bool capitalization) = 0;
+  virtual void SetDepositDailyAccrual(bool dailyAccrual) = 0;
   virtual void SetDepositDateStart(int year, int month, int day) = 0;
   virtual void AddDepositOperationReplenishment(int year, int month, int day,
                                                 double amount) = 0;
   virtual void AddDepositOperationWithdrawal(int year, int month, int day,
                                              double amount) = 0;
 
+  virtual void ImportDepositOperations(const std::string& path) = 0;
+  virtual void ClearImportedDepositOperations() = 0;
+
   virtual void ClearDepositOperationsList() = 0;
   virtual void CalculateDeposit() = 0;
 };
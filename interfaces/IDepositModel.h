@@ -19,12 +19,16 @@ class IDepositModel : public IDepositModelPublic {
   virtual void SetDepositTax(double tax) = 0;
   virtual void SetDepositPeriodicityType(IDepositType type) = 0;
   virtual void SetDepositCapitalization(bool capitalization) = 0;
+  virtual void SetDepositDailyAccrual(bool dailyAccrual) = 0;
   virtual void SetDepositDateStart(int year, int month, int day) = 0;
   virtual void AddDepositOperationReplenishment(int year, int month, int day,
                                                 double amount) = 0;
   virtual void AddDepositOperationWithdrawal(int year, int month, int day,
                                              double amount) = 0;
 
+  virtual void ImportDepositOperations(const std::string& path) = 0;
+  virtual void ClearImportedDepositOperations() = 0;
+
   virtual void ClearDepositOperationsList() = 0;
   virtual void CalculateDeposit() = 0;
 };
@@ -5,6 +5,7 @@
 #ifndef SMARTCALC_IDEPOSITMODELPUBLIC_H
 #define SMARTCALC_IDEPOSITMODELPUBLIC_H
 
+#include <cstddef>
 #include <string>
 
 #include "observers/IObserverDeposit.h"
@@ -30,6 +31,8 @@ class IDepositModelPublic {
   virtual double GetTax() = 0;
   virtual IDepositType GetDepositType() = 0;
   virtual bool GetDepositCapitalizationType() = 0;
+  virtual bool GetDepositDailyAccrual() = 0;
+  virtual std::size_t GetImportedDepositOperationsCount() = 0;
 
   virtual void AddObserver(IObserverDepositUpdate* observer) = 0;
   virtual void RemoveObserver(IObserverDepositUpdate* observer) = 0;
@@ -18,7 +18,12 @@ class IGraphController {
   virtual void SetEndX(double newX) = 0;
   virtual void SetBeginY(double newY) = 0;
   virtual void SetEndY(double newY) = 0;
+  virtual void SetBeginT(double newT) = 0;
+  virtual void SetEndT(double newT) = 0;
   virtual void SetYScaleAuto(bool flag) = 0;
+  virtual void SetGraphType(int type) = 0;
+  virtual void SetDerivativeOrder(int order) = 0;
+  virtual void SetMarkersEnabled(bool flag) = 0;
 
   virtual void CalculateGraph() = 0;
 };
@@ -5,12 +5,21 @@
 #ifndef SMARTCALC_IGRAPHMODELPUBLIC_H
 #define SMARTCALC_IGRAPHMODELPUBLIC_H
 
+#include <memory>
 #include <string>
-#include <vector>
 
+#include "../models/graph/GraphResult.h"
 #include "observers/IObserverGraph.h"
 
 namespace s21 {
+enum IGraphType {
+  ExplicitPlot,    // Графики функций y = f(x)
+  HeatmapPlot,     // Тепловая карта функции f(x, y)
+  ImplicitPlot,    // Неявно заданные кривые f(x, y) = 0
+  ParametricPlot,  // Параметрические кривые x(t), y(t)
+  PolarPlot,       // Кривые r(t) в полярных координатах
+};
+
 class IGraphModelPublic {
  public:
   virtual ~IGraphModelPublic() = default;
@@ -19,8 +28,13 @@ class IGraphModelPublic {
   virtual double GetXEnd() = 0;
   virtual double GetYBegin() = 0;
   virtual double GetYEnd() = 0;
+  virtual double GetTBegin() = 0;
+  virtual double GetTEnd() = 0;
   virtual bool GetYScaleAuto() = 0;
-  virtual const std::vector<std::pair<double, double>>& GetPoints() = 0;
+  virtual IGraphType GetGraphType() = 0;
+  virtual int GetDerivativeOrder() = 0;
+  virtual bool GetMarkersEnabled() = 0;
+  virtual std::shared_ptr<const GraphResult> GetGraphResult() = 0;
 
   virtual void AddObserver(IObserverGraphUpdate* observer) = 0;
   virtual void RemoveObserver(IObserverGraphUpdate* observer) = 0;
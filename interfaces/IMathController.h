@@ -14,11 +14,15 @@ class IMathController {
 
   virtual void SetExpression(const QString& str) = 0;
   virtual void SetX(double x) = 0;
+  virtual void SetSolveBegin(double a) = 0;
+  virtual void SetSolveEnd(double b) = 0;
   virtual void SetRadDegFactor(double value) = 0;
   virtual void ExpressionAdd(const char* add) = 0;
   virtual void ExpressionEraseEnd() = 0;
 
   virtual void CalculateX() = 0;
+  virtual void Solve() = 0;
+  virtual void Integrate() = 0;
 };
 }  // namespace s21
 
@@ -6,7 +6,10 @@
 #define SMARTCALC_IMATHMODELPUBLIC_H
 
 #include <string>
+#include <vector>
 
+#include "../models/math/equationSolver.h"
+#include "../models/math/integrator.h"
 #include "observers/IObserverMath.h"
 
 namespace s21 {
@@ -18,6 +21,11 @@ class IMathModelPublic {
   virtual double GetX() = 0;
   virtual std::string GetExpression() = 0;
   virtual bool IsCalc() = 0;
+  virtual double GetSolveBegin() = 0;
+  virtual double GetSolveEnd() = 0;
+  virtual std::vector<EquationRoot> GetRoots() = 0;
+  virtual bool IsIntegrated() = 0;
+  virtual IntegralResult GetIntegral() = 0;
 
   virtual void AddObserver(IObserverMathUpdate* observer) = 0;
   virtual void RemoveObserver(IObserverMathUpdate* observer) = 0;
@@ -51,6 +51,25 @@ class WrongYGraphException : public CalcException {
   virtual ~WrongYGraphException() = default;
 };
 
+class WrongTGraphException : public CalcException {
+ public:
+  explicit WrongTGraphException(const char* arg) : CalcException(arg){};
+  virtual ~WrongTGraphException() = default;
+};
+
+class WrongSolveRangeException : public CalcException {
+ public:
+  explicit WrongSolveRangeException(const char* arg) : CalcException(arg){};
+  virtual ~WrongSolveRangeException() = default;
+};
+
+class WrongIntegralRangeException : public CalcException {
+ public:
+  explicit WrongIntegralRangeException(const char* arg)
+      : CalcException(arg){};
+  virtual ~WrongIntegralRangeException() = default;
+};
+
 }  // namespace s21
 
 #endif  // SMARTCALC_CALCEXCEPTION_H
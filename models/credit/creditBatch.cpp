@@ -0,0 +1,107 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#include "creditBatch.h"
+
+#include <atomic>
+#include <limits>
+
+#include "../../helpers/parallelHelper.h"
+
+namespace s21 {
+
+/**
+ * @brief Рассчитывает итоги всех кредитов портфеля.
+ *
+ * Портфель делится на блоки по `blockSize` кредитов, блоки считаются
+ * параллельно. Каждый кредит проверяется по тем же границам, что и в
+ * `CreditModel`, и в том же проходе считается по тем же формулам, поэтому
+ * итоги совпадают с расчетом отдельной модели до последнего бита. График
+ * платежей не строится.
+ *
+ * @param input Суммы, сроки, ставки и типы кредитов.
+ * @param rounding Округление дифференцированных платежей.
+ * @param threads Количество потоков, 0 - по числу ядер.
+ * @return Итоги и статус проверки каждого кредита.
+ * @throw FinanceException если столбцы портфеля разной длины.
+ */
+CreditBatchResult CreditBatch::Calculate(const CreditBatchInput& input,
+                                         CreditModel::PaymentRounding rounding,
+                                         unsigned threads) {
+  std::size_t size = input.Size();
+
+  if (input.months.size() != size || input.interests.size() != size ||
+      input.types.size() != size) {
+    throw FinanceException("Credit batch columns differ in size");
+  }
+
+  CreditBatchResult result;
+  result.paymentMin.resize(size);
+  result.paymentMax.resize(size);
+  result.overPayment.resize(size);
+  result.totalPayment.resize(size);
+  result.status.resize(size);
+
+  std::atomic<std::size_t> invalidCount{0};
+
+  parallelHelper::ParallelFor(
+      size, blockSize,
+      [&](std::size_t begin, std::size_t end) {
+        invalidCount += CalculateBlock(begin, end, input, rounding, result);
+      },
+      threads);
+
+  result.invalidCount = invalidCount;
+  return result;
+}
+
+/**
+ * @brief Проверяет и рассчитывает кредиты [begin, end) портфеля.
+ *
+ * @return Количество некорректных кредитов в блоке.
+ * @note Этот метод не бросает исключений (noexcept).
+ */
+std::size_t CreditBatch::CalculateBlock(std::size_t begin, std::size_t end,
+                                        const CreditBatchInput& input,
+                                        CreditModel::PaymentRounding rounding,
+                                        CreditBatchResult& result) noexcept {
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  std::size_t invalidCount = 0;
+
+  for (std::size_t i = begin; i < end; ++i) {
+    double sum = input.sums[i];
+    int months = input.months[i];
+    double interest = input.interests[i];
+    CreditBatchResult::Status status = CreditBatchResult::Ok;
+
+    if (!CreditModel::CheckSum(sum)) {
+      status = CreditBatchResult::WrongSum;
+    } else if (!CreditModel::CheckMonth(months)) {
+      status = CreditBatchResult::WrongMonths;
+    } else if (!CreditModel::CheckInterest(interest)) {
+      status = CreditBatchResult::WrongInterest;
+    }
+
+    CreditTotals totals{nan, nan, nan, nan};
+
+    if (status != CreditBatchResult::Ok) {
+      ++invalidCount;
+    } else if (input.types[i] == CreditModel::Annuity) {
+      totals = CreditModel::AnnuityTotals(sum, months, interest);
+    } else {
+      totals =
+          CreditModel::DifferentiatedTotals(sum, months, interest, rounding);
+    }
+
+    result.paymentMin[i] = totals.paymentMin;
+    result.paymentMax[i] = totals.paymentMax;
+    result.overPayment[i] = totals.overPayment;
+    result.totalPayment[i] = totals.totalPayment;
+    result.status[i] = status;
+  }
+
+  return invalidCount;
+}
+
+}  // namespace s21
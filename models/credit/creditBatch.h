@@ -0,0 +1,61 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALCV2_CREDITBATCH_H
+#define SMARTCALCV2_CREDITBATCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "creditModel.h"
+
+namespace s21 {
+
+// Портфель кредитов по столбцам: i-й кредит - i-е элементы всех векторов
+struct CreditBatchInput final {
+  std::vector<double> sums;
+  std::vector<int> months;
+  std::vector<double> interests;
+  std::vector<CreditModel::CreditType> types;
+
+  [[nodiscard]] std::size_t Size() const noexcept { return sums.size(); }
+};
+
+// Итоги по каждому кредиту портфеля, у некорректных кредитов - NaN
+struct CreditBatchResult final {
+  enum Status : std::uint8_t { Ok, WrongSum, WrongMonths, WrongInterest };
+
+  std::vector<double> paymentMin;
+  std::vector<double> paymentMax;
+  std::vector<double> overPayment;
+  std::vector<double> totalPayment;
+  std::vector<Status> status;
+  std::size_t invalidCount = 0;
+
+  [[nodiscard]] std::size_t Size() const noexcept { return status.size(); }
+};
+
+class CreditBatch final {
+ public:
+  CreditBatch() = delete;
+
+  [[nodiscard]] static CreditBatchResult Calculate(
+      const CreditBatchInput& input,
+      CreditModel::PaymentRounding rounding = CreditModel::RoundToKopecks,
+      unsigned threads = 0);
+
+ private:
+  // Столько кредитов считаются в одном потоке за раз
+  static constexpr std::size_t blockSize = 4096;
+
+  static std::size_t CalculateBlock(std::size_t begin, std::size_t end,
+                                    const CreditBatchInput& input,
+                                    CreditModel::PaymentRounding rounding,
+                                    CreditBatchResult& result) noexcept;
+};
+
+}  // namespace s21
+
+#endif  // SMARTCALCV2_CREDITBATCH_H
@@ -0,0 +1,37 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALCV2_CREDITEVENT_H
+#define SMARTCALCV2_CREDITEVENT_H
+
+namespace s21 {
+
+// Досрочное погашение. Месяцы считаются от начала кредита с единицы,
+// включая месяцы каникул. Погашение вносится вместе с платежом месяца
+struct CreditPrepayment final {
+  enum Effect {
+    ReduceTerm,     // Платеж сохраняется, срок сокращается
+    ReducePayment,  // Срок сохраняется, платеж уменьшается
+  };
+
+  // Месяц первого погашения
+  int month = 1;
+  // Сумма погашения
+  double amount = 0;
+  // Погашение повторяется каждые period месяцев, 0 - однократное
+  int period = 0;
+  Effect effect = ReduceTerm;
+};
+
+// Кредитные каникулы: length месяцев без платежей, начиная с месяца month.
+// Проценты за каникулы прибавляются к долгу, количество оставшихся
+// платежей не меняется, поэтому срок кредита удлиняется
+struct CreditHoliday final {
+  int month = 1;
+  int length = 1;
+};
+
+}  // namespace s21
+
+#endif  // SMARTCALCV2_CREDITEVENT_H
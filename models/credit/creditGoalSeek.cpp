@@ -0,0 +1,308 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#include "creditGoalSeek.h"
+
+#include <cmath>
+#include <limits>
+
+#include "../../helpers/parallelHelper.h"
+#include "../../helpers/rootHelper.h"
+#include "../financeException.h"
+#include "../money.h"
+#include "creditModel.h"
+
+namespace s21 {
+
+/**
+ * @brief Подбирает годовую процентную ставку, при которой аннуитетный
+ * платеж равен заданному.
+ *
+ * Платеж x(i) = S * (P + P / ((1 + P)^N - 1)), P = i / 1200, возрастает по
+ * ставке, поэтому корень x(i) = payment на отрезке допустимых ставок
+ * единственный. Он уточняется методом Ньютона с защитой делением пополам,
+ * производная платежа по ставке вычисляется аналитически.
+ *
+ * @param sum Сумма кредита.
+ * @param months Срок в месяцах.
+ * @param payment Желаемый ежемесячный платеж.
+ * @return Годовая ставка в процентах.
+ * @throw FinanceSumException если сумма некорректна.
+ * @throw FinanceMonthException если срок некорректен.
+ * @throw FinancePaymentException если платеж не достигается ни при какой
+ * допустимой ставке.
+ */
+double CreditGoalSeek::Interest(double sum, int months, double payment) {
+  if (!CreditModel::CheckSum(sum)) {
+    throw FinanceSumException("Incorrect sum");
+  }
+
+  if (!CreditModel::CheckMonth(months)) {
+    throw FinanceMonthException("Incorrect month");
+  }
+
+  CheckPayment(payment);
+
+  auto function = [&](double interest, double& slope) {
+    slope = AnnuitySlope(sum, months, interest);
+    return CreditModel::AnnuityTotals(sum, months, interest).paymentMin -
+           payment;
+  };
+
+  double slope;
+  double low = CreditModel::minCreditInterest;
+  double high = CreditModel::maxCreditInterest;
+  double fLow = function(low, slope);
+  double fHigh = function(high, slope);
+
+  if (!(fLow <= 0 && fHigh >= 0)) {
+    throw FinancePaymentException("Payment is out of interest range");
+  }
+
+  return rootHelper::NewtonRoot(function, low, high, fLow, fHigh,
+                                interestTolerance);
+}
+
+/**
+ * @brief Находит наибольшую сумму кредита, аннуитетный платеж по которой не
+ * больше заданного.
+ *
+ * Платеж пропорционален сумме, поэтому сумма находится делением платежа на
+ * платеж по кредиту в один рубль, округляется вниз до копеек и уточняется
+ * шагами в копейку по формуле платежа.
+ *
+ * @param payment Желаемый ежемесячный платеж.
+ * @param months Срок в месяцах.
+ * @param interest Годовая ставка в процентах.
+ * @return Сумма кредита.
+ * @throw FinanceMonthException если срок некорректен.
+ * @throw FinanceInterestException если ставка некорректна.
+ * @throw FinancePaymentException если сумма выходит за допустимые пределы.
+ */
+double CreditGoalSeek::Sum(double payment, int months, double interest) {
+  if (!CreditModel::CheckMonth(months)) {
+    throw FinanceMonthException("Incorrect month");
+  }
+
+  if (!CreditModel::CheckInterest(interest)) {
+    throw FinanceInterestException("Incorrect interest");
+  }
+
+  CheckPayment(payment);
+
+  double unitPayment =
+      CreditModel::AnnuityTotals(1, months, interest).paymentMin;
+  double exactSum = payment / unitPayment;
+
+  // Сумма, которая после округления вниз превышает допустимую, отсекается
+  // до перевода в копейки: большой платеж не помещается в std::int64_t
+  if (exactSum >= CreditModel::maxCreditSum + CreditModel::minCreditSum) {
+    throw FinancePaymentException("Payment is out of sum range");
+  }
+
+  Money sum = Money::FromDouble(exactSum, Money::Floor);
+
+  auto fits = [&](Money candidate) {
+    return CreditModel::AnnuityTotals(candidate.ToDouble(), months, interest)
+               .paymentMin <= payment;
+  };
+  Money kopeck = Money::FromKopecks(1);
+  Money maxSum = Money::FromDouble(CreditModel::maxCreditSum);
+
+  // Деление и округление могут сдвинуть сумму на копейку в любую сторону:
+  // платеж может оказаться больше заданного или следующая копейка еще
+  // укладывается в платеж
+  while (!fits(sum)) {
+    sum -= kopeck;
+  }
+
+  while (sum < maxSum && fits(sum + kopeck)) {
+    sum += kopeck;
+  }
+
+  if (!CreditModel::CheckSum(sum.ToDouble())) {
+    throw FinancePaymentException("Payment is out of sum range");
+  }
+
+  return sum.ToDouble();
+}
+
+/**
+ * @brief Находит наименьший срок, при котором аннуитетный платеж не больше
+ * заданного.
+ *
+ * Из x = S P / (1 - (1 + P)^-N) срок равен N = -ln(1 - S P / x) / ln(1 + P).
+ * Он округляется вверх и проверяется по формуле платежа на ±1 месяц, чтобы
+ * ошибка округления логарифмов не сдвинула ответ.
+ *
+ * @param sum Сумма кредита.
+ * @param payment Желаемый ежемесячный платеж.
+ * @param interest Годовая ставка в процентах.
+ * @return Срок в месяцах.
+ * @throw FinanceSumException если сумма некорректна.
+ * @throw FinanceInterestException если ставка некорректна.
+ * @throw FinancePaymentException если платеж не покрывает проценты или срок
+ * превышает допустимый.
+ */
+int CreditGoalSeek::Months(double sum, double payment, double interest) {
+  if (!CreditModel::CheckSum(sum)) {
+    throw FinanceSumException("Incorrect sum");
+  }
+
+  if (!CreditModel::CheckInterest(interest)) {
+    throw FinanceInterestException("Incorrect interest");
+  }
+
+  CheckPayment(payment);
+
+  double monthInterest = interest / (100 * 12);
+  double share = sum * monthInterest / payment;
+
+  if (share >= 1) {
+    throw FinancePaymentException("Payment does not cover interest");
+  }
+
+  double exact = -std::log1p(-share) / std::log1p(monthInterest);
+
+  if (!(exact <= CreditModel::maxCreditMonths + 1)) {
+    throw FinancePaymentException("Payment is out of months range");
+  }
+
+  int months = std::max(static_cast<int>(std::ceil(exact)),
+                        CreditModel::minCreditMonths);
+
+  auto fits = [&](int n) {
+    return CreditModel::AnnuityTotals(sum, n, interest).paymentMin <= payment;
+  };
+
+  if (months > CreditModel::minCreditMonths && fits(months - 1)) {
+    --months;
+  } else if (!fits(months)) {
+    ++months;
+  }
+
+  if (months > CreditModel::maxCreditMonths) {
+    throw FinancePaymentException("Payment is out of months range");
+  }
+
+  return months;
+}
+
+/**
+ * @brief Подбирает ставки для портфеля кредитов, см. `Interest`.
+ *
+ * @return Ставки, у кредитов без решения - NaN.
+ * @throw FinanceException если векторы разной длины.
+ */
+std::vector<double> CreditGoalSeek::Interests(
+    const std::vector<double>& sums, const std::vector<int>& months,
+    const std::vector<double>& payments, unsigned threads) {
+  if (months.size() != sums.size() || payments.size() != sums.size()) {
+    throw FinanceException("Goal seek columns differ in size");
+  }
+
+  return SeekAll(
+      sums.size(), std::numeric_limits<double>::quiet_NaN(),
+      [&](std::size_t i) { return Interest(sums[i], months[i], payments[i]); },
+      threads);
+}
+
+/**
+ * @brief Находит наибольшие суммы для портфеля кредитов, см. `Sum`.
+ *
+ * @return Суммы, у кредитов без решения - NaN.
+ * @throw FinanceException если векторы разной длины.
+ */
+std::vector<double> CreditGoalSeek::Sums(const std::vector<double>& payments,
+                                         const std::vector<int>& months,
+                                         const std::vector<double>& interests,
+                                         unsigned threads) {
+  if (months.size() != payments.size() ||
+      interests.size() != payments.size()) {
+    throw FinanceException("Goal seek columns differ in size");
+  }
+
+  return SeekAll(
+      payments.size(), std::numeric_limits<double>::quiet_NaN(),
+      [&](std::size_t i) { return Sum(payments[i], months[i], interests[i]); },
+      threads);
+}
+
+/**
+ * @brief Находит наименьшие сроки для портфеля кредитов, см. `Months`.
+ *
+ * @return Сроки, у кредитов без решения - 0.
+ * @throw FinanceException если векторы разной длины.
+ */
+std::vector<int> CreditGoalSeek::Months(const std::vector<double>& sums,
+                                        const std::vector<double>& payments,
+                                        const std::vector<double>& interests,
+                                        unsigned threads) {
+  if (payments.size() != sums.size() || interests.size() != sums.size()) {
+    throw FinanceException("Goal seek columns differ in size");
+  }
+
+  return SeekAll(
+      sums.size(), 0,
+      [&](std::size_t i) { return Months(sums[i], payments[i], interests[i]); },
+      threads);
+}
+
+/**
+ * @brief Проверяет, что платеж - конечное положительное число.
+ * @throw FinancePaymentException если платеж некорректен.
+ */
+void CreditGoalSeek::CheckPayment(double payment) {
+  if (!(payment > 0) || std::isinf(payment)) {
+    throw FinancePaymentException("Incorrect payment");
+  }
+}
+
+/**
+ * @brief Вычисляет производную аннуитетного платежа по годовой ставке.
+ *
+ * При q = (1 + P)^-N платеж равен S P / (1 - q), его производная по P равна
+ * S (1 - q - P N q / (1 + P)) / (1 - q)^2, а по ставке в процентах годовых
+ * она в 1200 раз меньше.
+ */
+double CreditGoalSeek::AnnuitySlope(double sum, int months,
+                                    double interest) noexcept {
+  double monthInterest = interest / (100 * 12);
+  double q = std::pow(1 + monthInterest, -months);
+  double rest = 1 - q;
+  return sum * (rest - monthInterest * months * q / (1 + monthInterest)) /
+         (rest * rest) / (100 * 12);
+}
+
+/**
+ * @brief Решает задачи подбора для всех кредитов портфеля параллельно.
+ *
+ * @param size Количество кредитов.
+ * @param failed Значение результата для кредита без решения.
+ * @param seek Подбор для одного кредита `Result(std::size_t)`, бросающий
+ * FinanceException, если решения нет.
+ * @param threads Количество потоков, 0 - по числу ядер.
+ */
+template <class Result, class Seek>
+std::vector<Result> CreditGoalSeek::SeekAll(std::size_t size, Result failed,
+                                            Seek seek, unsigned threads) {
+  std::vector<Result> results(size, failed);
+
+  parallelHelper::ParallelFor(
+      size, blockSize,
+      [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+          try {
+            results[i] = seek(i);
+          } catch (const FinanceException&) {
+            results[i] = failed;
+          }
+        }
+      },
+      threads);
+
+  return results;
+}
+
+}  // namespace s21
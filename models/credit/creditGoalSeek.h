@@ -0,0 +1,50 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALCV2_CREDITGOALSEEK_H
+#define SMARTCALCV2_CREDITGOALSEEK_H
+
+#include <cstddef>
+#include <vector>
+
+namespace s21 {
+
+// Подбор параметра аннуитетного кредита по желаемому ежемесячному платежу
+class CreditGoalSeek final {
+ public:
+  CreditGoalSeek() = delete;
+
+  [[nodiscard]] static double Interest(double sum, int months,
+                                       double payment);
+  [[nodiscard]] static double Sum(double payment, int months,
+                                  double interest);
+  [[nodiscard]] static int Months(double sum, double payment,
+                                  double interest);
+
+  [[nodiscard]] static std::vector<double> Interests(
+      const std::vector<double>& sums, const std::vector<int>& months,
+      const std::vector<double>& payments, unsigned threads = 0);
+  [[nodiscard]] static std::vector<double> Sums(
+      const std::vector<double>& payments, const std::vector<int>& months,
+      const std::vector<double>& interests, unsigned threads = 0);
+  [[nodiscard]] static std::vector<int> Months(
+      const std::vector<double>& sums, const std::vector<double>& payments,
+      const std::vector<double>& interests, unsigned threads = 0);
+
+ private:
+  // Точность подобранной ставки в процентах годовых
+  static constexpr double interestTolerance = 1E-10;
+  static constexpr std::size_t blockSize = 1024;
+
+  static void CheckPayment(double payment);
+  static double AnnuitySlope(double sum, int months, double interest) noexcept;
+
+  template <class Result, class Seek>
+  static std::vector<Result> SeekAll(std::size_t size, Result failed,
+                                     Seek seek, unsigned threads);
+};
+
+}  // namespace s21
+
+#endif  // SMARTCALCV2_CREDITGOALSEEK_H
@@ -0,0 +1,51 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALCV2_CREDITGRID_H
+#define SMARTCALCV2_CREDITGRID_H
+
+#include <cstddef>
+#include <vector>
+
+namespace s21 {
+
+// Сетка ежемесячных платежей и переплат по ставкам и срокам. Строка i -
+// ставка Interest(i), столбец j - срок Months(j), значения хранятся по
+// строкам. У дифференцированного кредита платеж - первый, наибольший
+struct CreditGrid final {
+  double interestBegin = 0;
+  double interestEnd = 0;
+  int rates = 0;
+  int monthsBegin = 0;
+  int monthsEnd = 0;
+  std::vector<double> payments;
+  std::vector<double> overPayments;
+
+  [[nodiscard]] int Terms() const noexcept {
+    return rates > 0 ? monthsEnd - monthsBegin + 1 : 0;
+  }
+
+  [[nodiscard]] double Interest(int i) const noexcept {
+    return rates > 1 ? interestBegin + (interestEnd - interestBegin) * i /
+                                           (rates - 1)
+                     : interestBegin;
+  }
+
+  [[nodiscard]] int Months(int j) const noexcept { return monthsBegin + j; }
+
+  [[nodiscard]] std::size_t Index(int i, int j) const noexcept {
+    return static_cast<std::size_t>(i) * static_cast<std::size_t>(Terms()) +
+           static_cast<std::size_t>(j);
+  }
+
+  void Clear() noexcept {
+    rates = 0;
+    payments.clear();
+    overPayments.clear();
+  }
+};
+
+}  // namespace s21
+
+#endif  // SMARTCALCV2_CREDITGRID_H
@@ -6,7 +6,10 @@
 
 #include <cmath>
 
-#include "../../helpers/mathHelper.h"
+#include "../money.h"
+#include "creditScenario.h"
+#include "creditSensitivity.h"
+
 namespace s21 {
 
 /**
@@ -20,11 +23,18 @@ CreditModel::CreditModel() noexcept
       _months(0),
       _interest(0),
       _type(Annuity),
+      _rounding(RoundToKopecks),
+      prepayments(),
+      holidays(),
       _isCalc(false),
+      _isScenario(false),
+      _isScheduleCalc(false),
       paymentMin(0),
       paymentMax(0),
       overPayment(0),
-      totalPayment(0) {}
+      totalPayment(0),
+      schedule(),
+      grid() {}
 
 /**
  * @brief Выполняет расчет параметров кредита.
@@ -38,11 +48,30 @@ void CreditModel::CalculateCredit() {
   CalculateHandle();
 }
 
+/**
+ * @brief Рассчитывает сетку платежей и переплат по ставкам и срокам для
+ * текущих суммы и типа кредита.
+ *
+ * Результаты основного расчета не меняются. При ошибке сетка очищается.
+ * @see CreditSensitivity::Calculate
+ */
+void CreditModel::CalculateGrid(double interestBegin, double interestEnd,
+                                int rates, int monthsBegin, int monthsEnd) {
+  try {
+    CreditSensitivity::Calculate(_sum, _type, interestBegin, interestEnd,
+                                 rates, monthsBegin, monthsEnd, grid);
+  } catch (const FinanceException&) {
+    grid.Clear();
+    throw;
+  }
+}
+
 /**
  * @brief Сбрасывает результаты расчета кредита.
  *
  * Метод `ResetResults()` сбрасывает результаты предыдущего расчета,
- * устанавливая все параметры платежей и переплаты в нулевые значения.
+ * устанавливая все параметры платежей и переплаты в нулевые значения и
+ * очищая график платежей.
  * @note Этот метод не бросает исключений (noexcept).
  */
 void CreditModel::ResetResults() noexcept {
@@ -50,63 +79,191 @@ void CreditModel::ResetResults() noexcept {
   paymentMin = 0;
   overPayment = 0;
   totalPayment = 0;
+  _isScenario = false;
+  _isScheduleCalc = false;
+  schedule.Clear();
 }
 
 /**
  * @brief Выполняет расчет параметров кредита в зависимости от типа кредита.
  *
- * Метод `CalculateHandle()` осуществляет расчет параметров кредита
+ * Метод `CalculateHandle()` осуществляет расчет итогов кредита
  * в зависимости от типа кредита (Аннуитетный или Дифференцированный).
- * @note Этот метод не бросает исключений (noexcept).
+ * Помесячный график не строится, его заполняет `CalculateSchedule()` по
+ * запросу. Если заданы досрочные погашения или каникулы, кредит
+ * рассчитывается `CreditScenario`. События, которые пришлись на месяцы после
+ * конца срока, кредит не меняют, поэтому тогда он рассчитывается так же, как
+ * без событий.
+ */
+void CreditModel::CalculateHandle() {
+  CreditTotals totals;
+
+  if (!prepayments.empty() || !holidays.empty()) {
+    CreditScenario scenario(_sum, _months, _interest, _type, _rounding);
+    CreditScenarioResult result = scenario.Calculate(prepayments, holidays);
+    _isScenario = result.events > 0;
+    totals = result.totals;
+  }
+
+  if (!_isScenario) {
+    totals = _type == Annuity
+                 ? AnnuityTotals(_sum, _months, _interest)
+                 : DifferentiatedTotals(_sum, _months, _interest, _rounding);
+  }
+
+  paymentMin = totals.paymentMin;
+  paymentMax = totals.paymentMax;
+  overPayment = totals.overPayment;
+  totalPayment = totals.totalPayment;
+  _isCalc = true;
+}
+
+/**
+ * @brief Заполняет помесячный график рассчитанного кредита.
+ *
+ * График строится один раз после каждого расчета: платеж, погашение долга,
+ * проценты и остаток долга после платежа. Без расчета или после изменения
+ * параметров график остается пустым. Итоги расчета не меняются.
  */
-void CreditModel::CalculateHandle() noexcept {
+void CreditModel::CalculateSchedule() {
+  if (!_isCalc || _isScheduleCalc) {
+    return;
+  }
+
+  _isScheduleCalc = true;
+
+  if (_isScenario) {
+    CreditScenario scenario(_sum, _months, _interest, _type, _rounding);
+    scenario.Calculate(prepayments, holidays, &schedule);
+    return;
+  }
+
+  schedule.Resize(static_cast<std::size_t>(_months));
+  double monthInterest = _interest / (100 * 12);
+
   if (_type == Annuity) {
-    double totalPay;
-    double overPay;
-    double monthInterest = _interest / (100 * 12);
-    double monthPay =
-        _sum * (monthInterest +
-                monthInterest / (std::pow(monthInterest + 1, _months) - 1));
-    // x = S * (P + P / ((1 + P)^N - 1))
-    // Здесь S — сумма займа, P — 1/100 доля процентной ставки (в месяц), N —
-    // срок кредитования (в месяцах).
-    totalPay = monthPay * _months;
-    overPay = totalPay - _sum;
-
-    paymentMin = monthPay;
-    paymentMax = monthPay;
-    overPayment = overPay;
-    totalPayment = totalPay;
+    double monthPay = paymentMin;
+    double balance = _sum;
+
+    for (int i = 0; i < _months; ++i) {
+      double payAdd = balance * monthInterest;
+      double payMain = monthPay - payAdd;
+      balance -= payMain;
+      schedule.payments[i] = monthPay;
+      schedule.principals[i] = payMain;
+      schedule.interests[i] = payAdd;
+      schedule.balances[i] = balance;
+    }
   } else if (_type == Differentiated) {
-    double monthPayMin = _sum + 2 * _sum * (maxCreditInterest / (12 * 100));
-    double monthPayMax = 0;
-    double totalPay = 0;
     double payMain = _sum / _months;
-    double monthInterest = _interest / (100 * 12);
     double tempSum = _sum;
 
     for (int i = 0; i < _months; ++i) {
       double payAdd = tempSum * monthInterest;
       tempSum -= payMain;
-      double monthPay = mathHelper::Round(payMain + payAdd, 2);
-      totalPay += monthPay;
+      double monthPay = payMain + payAdd;
+      schedule.payments[i] =
+          _rounding == RoundToKopecks ? Money::FromDouble(monthPay).ToDouble()
+                                      : monthPay;
+      schedule.principals[i] = payMain;
+      schedule.interests[i] = payAdd;
+      schedule.balances[i] = tempSum;
+    }
+  }
 
-      if (monthPay > monthPayMax) {
-        monthPayMax = monthPay;
-      }
+  // Остаток после последнего платежа отличается от нуля только ошибкой
+  // округления
+  if (!schedule.balances.empty()) {
+    schedule.balances.back() = 0;
+  }
+}
 
-      if (monthPay < monthPayMin) {
-        monthPayMin = monthPay;
-      }
+/**
+ * @brief Считает итоги аннуитетного кредита без построения графика.
+ *
+ * Все платежи равны x = S * (P + P / ((1 + P)^N - 1)), где S - сумма займа,
+ * P - 1/100 доля процентной ставки (в месяц), N - срок кредитования (в
+ * месяцах).
+ *
+ * @param sum Сумма кредита S.
+ * @param months Срок N в месяцах.
+ * @param interest Годовая ставка в процентах.
+ * @return Платеж, переплата и общая выплата.
+ * @note Этот метод не бросает исключений (noexcept).
+ */
+CreditTotals CreditModel::AnnuityTotals(double sum, int months,
+                                        double interest) noexcept {
+  CreditTotals totals;
+  double monthInterest = interest / (100 * 12);
+  double monthPay =
+      sum * (monthInterest +
+             monthInterest / (std::pow(monthInterest + 1, months) - 1));
+  totals.paymentMin = monthPay;
+  totals.paymentMax = monthPay;
+  totals.totalPayment = monthPay * months;
+  totals.overPayment = totals.totalPayment - sum;
+  return totals;
+}
+
+/**
+ * @brief Считает итоги дифференцированного кредита без построения графика.
+ *
+ * Основной долг гасится равными частями S / N, проценты начисляются на
+ * остаток, поэтому платежи убывают: наибольший - первый, наименьший -
+ * последний. Без округления проценты образуют арифметическую прогрессию и
+ * в сумме равны S P (N + 1) / 2, итоги считаются за O(1). С округлением
+ * каждого платежа до копеек сумма зависит от округления каждого месяца,
+ * поэтому платежи суммируются в цикле в том же порядке, что и раньше, а
+ * копейки округляются без std::pow.
+ *
+ * @param sum Сумма кредита S.
+ * @param months Срок N в месяцах.
+ * @param interest Годовая ставка в процентах.
+ * @param rounding Округление платежей.
+ * @return Наименьший и наибольший платежи, переплата и общая выплата.
+ * @throw FinanceOverflowException если с округлением платеж не помещается в
+ * копейки. Для суммы и ставки в допустимых пределах не бросается.
+ */
+CreditTotals CreditModel::DifferentiatedTotals(
+    double sum, int months, double interest, PaymentRounding rounding) {
+  CreditTotals totals;
+  double payMain = sum / months;
+  double monthInterest = interest / (100 * 12);
+
+  if (rounding == Unrounded) {
+    totals.paymentMax = payMain + sum * monthInterest;
+    totals.paymentMin = payMain * (1 + monthInterest);
+    totals.overPayment = sum * monthInterest * (months + 1) / 2;
+    totals.totalPayment = sum + totals.overPayment;
+    return totals;
+  }
+
+  // Округленные платежи складываются в копейках без накопления ошибки
+  Money monthPayMin;
+  Money monthPayMax;
+  Money totalPay;
+  double tempSum = sum;
+
+  for (int i = 0; i < months; ++i) {
+    double payAdd = tempSum * monthInterest;
+    tempSum -= payMain;
+    Money monthPay = Money::FromDouble(payMain + payAdd);
+    totalPay += monthPay;
+
+    if (monthPay > monthPayMax) {
+      monthPayMax = monthPay;
     }
 
-    overPayment = totalPay - _sum;
-    paymentMin = monthPayMin;
-    paymentMax = monthPayMax;
-    totalPayment = totalPay;
+    if (i == 0 || monthPay < monthPayMin) {
+      monthPayMin = monthPay;
+    }
   }
 
-  _isCalc = true;
+  totals.paymentMin = monthPayMin.ToDouble();
+  totals.paymentMax = monthPayMax.ToDouble();
+  totals.overPayment = totalPay.ToDouble() - sum;
+  totals.totalPayment = totalPay.ToDouble();
+  return totals;
 }
 
 /**
@@ -117,44 +274,77 @@ void CreditModel::CalculateHandle() noexcept {
  * Если какой-либо из параметров некорректен, метод выбрасывает исключение.
  */
 void CreditModel::CheckModel() const {
-  if (!CheckSum()) {
+  if (!CheckSum(_sum)) {
     throw s21::FinanceSumException("Incorrect sum");
   }
 
-  if (!CheckSum()) {
+  if (!CheckMonth(_months)) {
     throw s21::FinanceMonthException("Incorrect month");
   }
 
-  if (!CheckSum()) {
+  if (!CheckInterest(_interest)) {
     throw s21::FinanceInterestException("Incorrect interest");
   }
+
+  CheckEvents();
+}
+
+/**
+ * @brief Проверяет досрочные погашения и каникулы.
+ *
+ * Месяцы событий должны быть в пределах допустимого срока, суммы погашений -
+ * в пределах допустимой суммы кредита, а каникулы в сумме не длиннее
+ * допустимого срока.
+ * @throw FinanceEventException если событие некорректно.
+ */
+void CreditModel::CheckEvents() const {
+  for (const CreditPrepayment& prepayment : prepayments) {
+    if (!CheckMonth(prepayment.month) || !CheckSum(prepayment.amount) ||
+        prepayment.period < 0 || prepayment.period > maxCreditMonths) {
+      throw s21::FinanceEventException("Incorrect prepayment");
+    }
+  }
+
+  int holidayMonths = 0;
+
+  for (const CreditHoliday& holiday : holidays) {
+    holidayMonths += holiday.length;
+
+    if (!CheckMonth(holiday.month) || !CheckMonth(holiday.length) ||
+        holidayMonths > maxCreditMonths) {
+      throw s21::FinanceEventException("Incorrect holiday");
+    }
+  }
 }
 
 /**
- * @brief Проверяет корректность введенной суммы кредита.
+ * @brief Проверяет корректность суммы кредита.
+ * @param sum Сумма кредита.
  * @return true если сумма кредита корректна, в противном случае - false.
  */
-bool CreditModel::CheckSum() const noexcept {
-  return !(_sum < minCreditSum || _sum > maxCreditSum || std::isinf(_sum) ||
-           std::isnan(_sum));
+bool CreditModel::CheckSum(double sum) noexcept {
+  return !(sum < minCreditSum || sum > maxCreditSum || std::isinf(sum) ||
+           std::isnan(sum));
 }
 
 /**
- * @brief Проверяет корректность введенного срока кредита.
+ * @brief Проверяет корректность срока кредита.
+ * @param months Срок кредита в месяцах.
  * @return true если срок кредита корректен, в противном случае - false.
  */
-bool CreditModel::CheckMonth() const noexcept {
-  return !(_months < minCreditMonths || _months > maxCreditMonths);
+bool CreditModel::CheckMonth(int months) noexcept {
+  return !(months < minCreditMonths || months > maxCreditMonths);
 }
 
 /**
- * @brief Проверяет корректность введенной процентной ставки кредита.
+ * @brief Проверяет корректность процентной ставки кредита.
+ * @param interest Годовая процентная ставка.
  * @return true если процентная ставка кредита корректна, в противном случае -
  * false.
  */
-bool CreditModel::CheckInterest() const noexcept {
-  return !(_interest < minCreditInterest || _interest > maxCreditInterest ||
-           std::isnan(_interest) || std::isinf(_interest));
+bool CreditModel::CheckInterest(double interest) noexcept {
+  return !(interest < minCreditInterest || interest > maxCreditInterest ||
+           std::isnan(interest) || std::isinf(interest));
 }
 
-}  // namespace s21
\ No newline at end of file
+}  // namespace s21
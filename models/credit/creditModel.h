@@ -4,20 +4,37 @@
 
 #ifndef SMARTCALCV2_CREDITMODEL_H
 #define SMARTCALCV2_CREDITMODEL_H
+#include <vector>
+
 #include "../financeException.h"
+#include "creditEvent.h"
+#include "creditGrid.h"
+#include "creditSchedule.h"
 
 namespace s21 {
 
+// Итоги расчета кредита без помесячного графика
+struct CreditTotals final {
+  double paymentMin = 0;
+  double paymentMax = 0;
+  double overPayment = 0;
+  double totalPayment = 0;
+};
+
 class CreditModel final {
  public:
   enum CreditType { Annuity, Differentiated };
-
-  const double minCreditSum = 0.01;
-  const double maxCreditSum = 9999999999.99;
-  const int minCreditMonths = 1;
-  const int maxCreditMonths = 600;
-  const double minCreditInterest = 0.01;
-  const double maxCreditInterest = 999.0;
+  // Округление дифференцированных платежей: до копеек каждый месяц, как в
+  // банковском графике, или без округления - тогда итоги считаются по
+  // формулам за O(1)
+  enum PaymentRounding { RoundToKopecks, Unrounded };
+
+  static constexpr double minCreditSum = 0.01;
+  static constexpr double maxCreditSum = 9999999999.99;
+  static constexpr int minCreditMonths = 1;
+  static constexpr int maxCreditMonths = 600;
+  static constexpr double minCreditInterest = 0.01;
+  static constexpr double maxCreditInterest = 999.0;
 
   CreditModel() noexcept;
   CreditModel(const CreditModel& other) = delete;
@@ -46,37 +63,93 @@ class CreditModel final {
     _isCalc = false;
   }
 
+  void setRounding(PaymentRounding newRounding) {
+    _rounding = newRounding;
+    _isCalc = false;
+  }
+
+  void AddPrepayment(int month, double amount, int period,
+                     CreditPrepayment::Effect effect) {
+    prepayments.push_back({month, amount, period, effect});
+    _isCalc = false;
+  }
+
+  void AddHoliday(int month, int length) {
+    holidays.push_back({month, length});
+    _isCalc = false;
+  }
+
+  void ClearEvents() noexcept {
+    prepayments.clear();
+    holidays.clear();
+    _isCalc = false;
+  }
+
   [[nodiscard]] double getSum() const noexcept { return _sum; };
   [[nodiscard]] double getInterest() const noexcept { return _interest; };
   [[nodiscard]] int getMonths() const noexcept { return _months; };
   [[nodiscard]] CreditType getType() const noexcept { return _type; };
+  [[nodiscard]] PaymentRounding getRounding() const noexcept {
+    return _rounding;
+  };
+  [[nodiscard]] const std::vector<CreditPrepayment>& getPrepayments()
+      const noexcept {
+    return prepayments;
+  };
+  [[nodiscard]] const std::vector<CreditHoliday>& getHolidays()
+      const noexcept {
+    return holidays;
+  };
   [[nodiscard]] bool getIsCalc() const noexcept { return _isCalc; };
+  [[nodiscard]] const CreditGrid& getGrid() const noexcept { return grid; };
 
   [[nodiscard]] double getPaymentMin() const noexcept { return paymentMin; };
   [[nodiscard]] double getPaymentMax() const noexcept { return paymentMax; };
   [[nodiscard]] double getOverPayment() const noexcept { return overPayment; };
   [[nodiscard]] double getTotalPayment() const noexcept { return totalPayment; };
+  [[nodiscard]] const CreditSchedule& getSchedule() const noexcept {
+    return schedule;
+  };
 
   void CalculateCredit();
+  void CalculateSchedule();
+  void CalculateGrid(double interestBegin, double interestEnd, int rates,
+                     int monthsBegin, int monthsEnd);
+
+  [[nodiscard]] static CreditTotals AnnuityTotals(double sum, int months,
+                                                  double interest) noexcept;
+  [[nodiscard]] static CreditTotals DifferentiatedTotals(
+      double sum, int months, double interest, PaymentRounding rounding);
+
+  [[nodiscard]] static bool CheckSum(double sum) noexcept;
+  [[nodiscard]] static bool CheckMonth(int months) noexcept;
+  [[nodiscard]] static bool CheckInterest(double interest) noexcept;
 
  private:
   void ResetResults() noexcept;
-  void CalculateHandle() noexcept;
+  void CalculateHandle();
   void CheckModel() const;
-  [[nodiscard]] bool CheckSum() const noexcept;
-  [[nodiscard]] bool CheckMonth() const noexcept;
-  [[nodiscard]] bool CheckInterest() const noexcept;
+  void CheckEvents() const;
 
   double _sum;
   int _months;
   double _interest;
   CreditType _type;
+  PaymentRounding _rounding;
+  std::vector<CreditPrepayment> prepayments;
+  std::vector<CreditHoliday> holidays;
 
   bool _isCalc;
+  // Итоги рассчитаны CreditScenario, график строится тоже им
+  bool _isScenario;
+  // График построен для текущего расчета
+  bool _isScheduleCalc;
   double paymentMin;
   double paymentMax;
   double overPayment;
   double totalPayment;
+  CreditSchedule schedule;
+  CreditGrid grid;
 };
 
 }  // namespace s21
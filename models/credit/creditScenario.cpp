@@ -0,0 +1,553 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#include "creditScenario.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace s21 {
+
+namespace {
+
+// Допуск на ошибку округления при вычислении срока по логарифмам
+const double termTolerance = 1E-9;
+
+}  // namespace
+
+/**
+ * @brief Конструктор класса CreditScenario.
+ *
+ * @param sum Сумма кредита.
+ * @param months Срок кредита в месяцах без каникул.
+ * @param interest Годовая ставка в процентах.
+ * @param type Тип платежей.
+ * @param rounding Округление дифференцированных платежей.
+ * @note Параметры должны быть проверены `CreditModel`.
+ */
+CreditScenario::CreditScenario(double sum, int months, double interest,
+                               CreditModel::CreditType type,
+                               CreditModel::PaymentRounding rounding) noexcept
+    : _sum(sum),
+      _months(months),
+      _interest(interest),
+      _type(type),
+      monthInterest(interest / (100 * 12)),
+      roundPayments(type == CreditModel::Differentiated &&
+                    rounding == CreditModel::RoundToKopecks),
+      month(0),
+      balance(0),
+      paymentsLeft(0),
+      payment(0),
+      result(),
+      roundedTotal(),
+      _schedule(nullptr),
+      repeats(),
+      holidayRanges(),
+      holidayIndex(0) {}
+
+/**
+ * @brief Рассчитывает кредит с досрочными погашениями и каникулами.
+ *
+ * Каникулы и погашения перебираются по месяцам, повторяющееся погашение -
+ * одно событие, месяц которого сдвигается после каждого повторения. Между
+ * событиями платежи не меняются, поэтому расчет перескакивает к следующему
+ * событию по формулам: у аннуитета остаток после k платежей x равен
+ * B (1 + P)^k - x ((1 + P)^k - 1) / P, у дифференцированного кредита
+ * проценты за k месяцев - арифметическая прогрессия. Подряд идущие месяцы
+ * каникул пропускаются за один шаг, а повторения погашения с сокращением
+ * срока - сразу на много периодов, см. JumpRepeats(). Без графика расчет
+ * занимает O(событий) вне зависимости от срока и количества повторений,
+ * график заполняется помесячно только по запросу. Последний платеж гасит
+ * остаток долга целиком. Дифференцированные платежи с округлением до
+ * копеек, как и в `CreditModel::DifferentiatedTotals`, складываются
+ * помесячно.
+ *
+ * @param prepayments Досрочные погашения.
+ * @param holidays Кредитные каникулы.
+ * @param schedule График платежей или nullptr, если он не нужен.
+ * @return Итоги и фактический срок кредита.
+ */
+CreditScenarioResult CreditScenario::Calculate(
+    const std::vector<CreditPrepayment>& prepayments,
+    const std::vector<CreditHoliday>& holidays, CreditSchedule* schedule) {
+  result = CreditScenarioResult();
+  result.totals.paymentMin = std::numeric_limits<double>::infinity();
+  roundedTotal = Money();
+  month = 0;
+  balance = _sum;
+  paymentsLeft = _months;
+  payment = _type == CreditModel::Annuity
+                ? CreditModel::AnnuityTotals(_sum, _months, _interest)
+                      .paymentMin
+                : _sum / _months;
+  _schedule = schedule;
+
+  if (_schedule) {
+    _schedule->Clear();
+  }
+
+  CollectEvents(prepayments, holidays);
+
+  while (paymentsLeft > 0) {
+    int holidayMonth = NextHoliday();
+    int eventMonth = std::min(holidayMonth, NextRepeat());
+
+    // Кредит погашается раньше события
+    if (eventMonth == noEvent || eventMonth - 1 - month >= paymentsLeft) {
+      break;
+    }
+
+    Pay(eventMonth - 1 - month);
+
+    if (eventMonth == holidayMonth) {
+      // Погашение в месяц каникул вносится после пропуска платежа
+      int last = std::min(holidayRanges[holidayIndex].last, NextRepeat());
+      SkipPayments(last - eventMonth + 1);
+      eventMonth = last;
+    } else if (paymentsLeft == 1) {
+      // Последний платеж гасит весь долг, погашать досрочно нечего
+      break;
+    } else {
+      Pay(1);
+    }
+
+    ApplyPrepayments(eventMonth);
+  }
+
+  if (paymentsLeft > 0) {
+    Pay(paymentsLeft - 1);
+    PayLast();
+  }
+
+  // Кредит погашен досрочно в каникулы, ни одного платежа не было
+  if (std::isinf(result.totals.paymentMin)) {
+    result.totals.paymentMin = 0;
+  }
+
+  if (roundPayments) {
+    result.totals.totalPayment = roundedTotal.ToDouble();
+  }
+
+  result.totals.overPayment = result.totals.totalPayment - _sum;
+  result.months = month;
+  return result;
+}
+
+/**
+ * @brief Готовит погашения к расчету и объединяет пересекающиеся каникулы.
+ */
+void CreditScenario::CollectEvents(
+    const std::vector<CreditPrepayment>& prepayments,
+    const std::vector<CreditHoliday>& holidays) {
+  repeats.clear();
+
+  for (const CreditPrepayment& prepayment : prepayments) {
+    repeats.push_back({&prepayment, prepayment.month});
+  }
+
+  holidayRanges.clear();
+
+  for (const CreditHoliday& holiday : holidays) {
+    int last = holiday.month + holiday.length - 1;
+    holidayRanges.push_back({holiday.month, last});
+  }
+
+  std::sort(holidayRanges.begin(), holidayRanges.end(),
+            [](const HolidayRange& lhs, const HolidayRange& rhs) {
+              return lhs.first < rhs.first;
+            });
+
+  std::size_t count = 0;
+
+  for (const HolidayRange& range : holidayRanges) {
+    if (count > 0 && range.first <= holidayRanges[count - 1].last + 1) {
+      holidayRanges[count - 1].last =
+          std::max(holidayRanges[count - 1].last, range.last);
+    } else {
+      holidayRanges[count++] = range;
+    }
+  }
+
+  holidayRanges.resize(count);
+  holidayIndex = 0;
+}
+
+/**
+ * @brief Возвращает ближайший месяц каникул после прошедших месяцев или
+ * noEvent.
+ */
+int CreditScenario::NextHoliday() noexcept {
+  while (holidayIndex < holidayRanges.size() &&
+         holidayRanges[holidayIndex].last <= month) {
+    ++holidayIndex;
+  }
+
+  if (holidayIndex == holidayRanges.size()) {
+    return noEvent;
+  }
+
+  return std::max(holidayRanges[holidayIndex].first, month + 1);
+}
+
+/**
+ * @brief Возвращает месяц ближайшего повторения погашений или noEvent.
+ *
+ * @param except Погашение, которое не учитывается.
+ */
+int CreditScenario::NextRepeat(const Repeat* except) const noexcept {
+  int next = noEvent;
+
+  for (const Repeat& repeat : repeats) {
+    if (&repeat != except) {
+      next = std::min(next, repeat.next);
+    }
+  }
+
+  return next;
+}
+
+/**
+ * @brief Вносит погашения месяца в порядке добавления и сдвигает их на
+ * следующее повторение.
+ */
+void CreditScenario::ApplyPrepayments(int eventMonth) {
+  Repeat* applied = nullptr;
+  int count = 0;
+
+  for (Repeat& repeat : repeats) {
+    if (repeat.next != eventMonth) {
+      continue;
+    }
+
+    if (paymentsLeft > 0) {
+      Prepay(*repeat.prepayment);
+      applied = &repeat;
+      ++count;
+    }
+
+    int period = repeat.prepayment->period;
+    repeat.next = period > 0 ? eventMonth + period : noEvent;
+  }
+
+  if (count == 1 && paymentsLeft > 0) {
+    JumpRepeats(*applied);
+  }
+}
+
+/**
+ * @brief Проходит сразу много повторений одного погашения с сокращением
+ * срока.
+ *
+ * Пока других событий нет, платеж x не меняется, и за период из p месяцев
+ * остаток переходит в B' = a B - c. У аннуитета a = (1 + P)^p и
+ * c = x (a - 1) / P + A, поэтому после j периодов
+ * B_j = K - (K - B) a^j, где K = c / (a - 1). У дифференцированного кредита
+ * a = 1 и c = p x + A. Повторения проходятся, пока остаток не меньше двух
+ * уменьшений c: оставшиеся до погашения кредита периоды считаются по
+ * одному, как и без перескока. Погашения с уменьшением платежа меняют
+ * платеж каждый период, поэтому их повторения проходятся по одному.
+ *
+ * @param repeat Погашение, только что внесенное в текущем месяце.
+ */
+void CreditScenario::JumpRepeats(Repeat& repeat) {
+  const CreditPrepayment& prepayment = *repeat.prepayment;
+  int period = prepayment.period;
+
+  if (period == 0 || prepayment.effect != CreditPrepayment::ReduceTerm ||
+      roundPayments) {
+    return;
+  }
+
+  // Повторения до ближайшего другого события
+  int other = std::min(NextHoliday(), NextRepeat(&repeat));
+  double cycles = other == noEvent
+                      ? std::numeric_limits<double>::infinity()
+                      : std::ceil(static_cast<double>(other - repeat.next) /
+                                  period);
+  double amount = prepayment.amount;
+  double debt = balance;
+  double logFactor = period * std::log1p(monthInterest);
+  double decrease;
+  double limit = 0;
+
+  if (_type == CreditModel::Annuity) {
+    double factor = std::expm1(logFactor);
+    decrease = payment * factor / monthInterest + amount;
+    limit = decrease / factor;
+
+    if (!(2 * decrease < debt && debt < limit)) {
+      return;
+    }
+
+    // B_j >= 2c при a^j <= (K - 2c) / (K - B)
+    cycles = std::min(
+        cycles,
+        std::floor(std::log((limit - 2 * decrease) / (limit - debt)) /
+                   logFactor));
+  } else {
+    decrease = period * payment + amount;
+    cycles = std::min(cycles, std::floor(debt / decrease) - 2);
+  }
+
+  // Перед каждым повторением должно оставаться больше period платежей,
+  // последнее повторение проходится по одному
+  cycles = std::min(cycles, std::floor((paymentsLeft - 1.0) / period) - 1);
+
+  if (!(cycles >= 1)) {
+    return;
+  }
+
+  int jumps = static_cast<int>(cycles);
+  int months = jumps * period;
+
+  if (_schedule) {
+    double rowBalance = debt;
+
+    for (int j = 0; j < jumps; ++j) {
+      for (int k = 0; k < period; ++k) {
+        double payAdd = rowBalance * monthInterest;
+        double payMain =
+            _type == CreditModel::Annuity ? payment - payAdd : payment;
+        rowBalance -= payMain;
+        AddRow(payMain + payAdd, payMain, payAdd);
+      }
+
+      rowBalance -= amount;
+      _schedule->payments.back() += amount;
+      _schedule->principals.back() += amount;
+      _schedule->balances.back() -= amount;
+    }
+  }
+
+  if (_type == CreditModel::Annuity) {
+    balance = limit - (limit - debt) * std::exp(jumps * logFactor);
+    result.totals.totalPayment += jumps * (period * payment + amount);
+    CountPayment(payment);
+  } else {
+    // Проценты периода j - прогрессия по j от остатка B - j c
+    double interestSum =
+        monthInterest *
+        (period * (jumps * debt - decrease * jumps * (jumps - 1) / 2.0) -
+         jumps * payment * period * (period - 1) / 2.0);
+    result.totals.totalPayment +=
+        jumps * (period * payment + amount) + interestSum;
+    CountPayment(payment + debt * monthInterest);
+    double lastDebt = debt - (jumps - 1) * decrease - (period - 1) * payment;
+    CountPayment(payment + lastDebt * monthInterest);
+    balance = debt - jumps * decrease;
+  }
+
+  month += months;
+  repeat.next += months;
+  result.events += jumps;
+  paymentsLeft = std::clamp(PaymentsFor(balance), 1, paymentsLeft - months);
+}
+
+/**
+ * @brief Вносит count очередных платежей, кроме последнего платежа кредита,
+ * за O(1) без графика и без округления.
+ *
+ * @param count Количество платежей, меньше количества оставшихся.
+ */
+void CreditScenario::Pay(int count) {
+  if (count <= 0) {
+    return;
+  }
+
+  if (roundPayments) {
+    // Каждый платеж округляется в том же порядке, что и без событий
+    for (int k = 0; k < count; ++k) {
+      double payAdd = balance * monthInterest;
+      balance -= payment;
+      Money monthPay = Money::FromDouble(payment + payAdd);
+      roundedTotal += monthPay;
+      CountPayment(monthPay.ToDouble());
+
+      if (_schedule) {
+        AddRow(monthPay.ToDouble(), payment, payAdd);
+      }
+    }
+
+    month += count;
+    paymentsLeft -= count;
+    return;
+  }
+
+  if (_schedule) {
+    double rowBalance = balance;
+
+    for (int k = 0; k < count; ++k) {
+      double payAdd = rowBalance * monthInterest;
+      double payMain =
+          _type == CreditModel::Annuity ? payment - payAdd : payment;
+      rowBalance -= payMain;
+      AddRow(payMain + payAdd, payMain, payAdd);
+    }
+  }
+
+  if (_type == CreditModel::Annuity) {
+    double growth = std::expm1(count * std::log1p(monthInterest));
+    // Части основного долга растут как (1 + P)^k от первой части x - B P
+    balance -= (payment - balance * monthInterest) * growth / monthInterest;
+    result.totals.totalPayment += count * payment;
+    CountPayment(payment);
+  } else {
+    result.totals.totalPayment +=
+        count * payment +
+        monthInterest * (count * balance - payment * count * (count - 1) / 2.0);
+    CountPayment(payment + balance * monthInterest);
+    CountPayment(payment + (balance - (count - 1) * payment) * monthInterest);
+    balance -= count * payment;
+  }
+
+  month += count;
+  paymentsLeft -= count;
+}
+
+/**
+ * @brief Вносит последний платеж, который гасит остаток долга с процентами.
+ */
+void CreditScenario::PayLast() {
+  double payAdd = balance * monthInterest;
+  double lastPayment = balance + payAdd;
+
+  if (roundPayments) {
+    lastPayment = Money::FromDouble(lastPayment).ToDouble();
+  }
+
+  AddPaid(lastPayment);
+
+  // У аннуитета последний платеж отличается от остальных только ошибкой
+  // округления, если срок не сокращался
+  if (_type == CreditModel::Annuity &&
+      std::abs(lastPayment - payment) < balanceTolerance) {
+    CountPayment(payment);
+  } else {
+    CountPayment(lastPayment);
+  }
+
+  if (_schedule) {
+    AddRow(lastPayment, balance, payAdd);
+    _schedule->balances.back() = 0;
+  }
+
+  balance = 0;
+  ++month;
+  paymentsLeft = 0;
+}
+
+/**
+ * @brief Пропускает платежи в count месяцев каникул подряд: проценты
+ * прибавляются к долгу, количество оставшихся платежей сохраняется, платеж
+ * пересчитывается.
+ */
+void CreditScenario::SkipPayments(int count) {
+  if (_schedule) {
+    double rowBalance = balance;
+
+    for (int k = 0; k < count; ++k) {
+      double accrued = rowBalance * monthInterest;
+      rowBalance += accrued;
+      AddRow(0, -accrued, accrued);
+    }
+  }
+
+  balance += balance * std::expm1(count * std::log1p(monthInterest));
+  payment = _type == CreditModel::Annuity
+                ? CreditModel::AnnuityTotals(balance, paymentsLeft, _interest)
+                      .paymentMin
+                : balance / paymentsLeft;
+  month += count;
+  result.events += count;
+}
+
+/**
+ * @brief Вносит досрочное погашение после платежа месяца и пересчитывает
+ * срок или платеж.
+ */
+void CreditScenario::Prepay(const CreditPrepayment& prepayment) {
+  double amount = std::min(prepayment.amount, balance);
+  balance -= amount;
+  ++result.events;
+
+  // Остаток меньше половины копейки гасится вместе с погашением
+  if (balance < balanceTolerance) {
+    amount += balance;
+    balance = 0;
+  }
+
+  AddPaid(amount);
+
+  if (_schedule) {
+    // Как и в общей выплате, при округлении платежей погашение вносится в
+    // копейках
+    _schedule->payments.back() +=
+        roundPayments ? Money::FromDouble(amount).ToDouble() : amount;
+    _schedule->principals.back() += amount;
+    _schedule->balances.back() = balance;
+  }
+
+  if (balance == 0) {
+    paymentsLeft = 0;
+    return;
+  }
+
+  if (prepayment.effect == CreditPrepayment::ReducePayment) {
+    payment = _type == CreditModel::Annuity
+                  ? CreditModel::AnnuityTotals(balance, paymentsLeft, _interest)
+                        .paymentMin
+                  : balance / paymentsLeft;
+    return;
+  }
+
+  paymentsLeft = std::clamp(PaymentsFor(balance), 1, paymentsLeft);
+}
+
+/**
+ * @brief Возвращает количество текущих платежей, которые погашают долг.
+ */
+int CreditScenario::PaymentsFor(double debt) const noexcept {
+  double exact = _type == CreditModel::Annuity
+                     ? -std::log1p(-debt * monthInterest / payment) /
+                           std::log1p(monthInterest)
+                     : debt / payment;
+  return static_cast<int>(std::ceil(exact - termTolerance));
+}
+
+/**
+ * @brief Учитывает очередной платеж в наименьшем и наибольшем платежах.
+ */
+void CreditScenario::CountPayment(double monthPay) noexcept {
+  result.totals.paymentMin = std::min(result.totals.paymentMin, monthPay);
+  result.totals.paymentMax = std::max(result.totals.paymentMax, monthPay);
+}
+
+/**
+ * @brief Учитывает в общей выплате платеж или погашение. При округлении
+ * платежей сумма округляется до копеек.
+ */
+void CreditScenario::AddPaid(double amount) {
+  if (roundPayments) {
+    roundedTotal += Money::FromDouble(amount);
+  } else {
+    result.totals.totalPayment += amount;
+  }
+}
+
+/**
+ * @brief Добавляет строку графика, остаток вычисляется по предыдущей строке.
+ */
+void CreditScenario::AddRow(double monthPay, double principal,
+                            double interest) {
+  double rowBalance =
+      (_schedule->Size() > 0 ? _schedule->balances.back() : _sum) - principal;
+  _schedule->payments.push_back(monthPay);
+  _schedule->principals.push_back(principal);
+  _schedule->interests.push_back(interest);
+  _schedule->balances.push_back(rowBalance);
+}
+
+}  // namespace s21
@@ -0,0 +1,107 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALCV2_CREDITSCENARIO_H
+#define SMARTCALCV2_CREDITSCENARIO_H
+
+#include <limits>
+#include <vector>
+
+#include "../money.h"
+#include "creditEvent.h"
+#include "creditModel.h"
+#include "creditSchedule.h"
+
+namespace s21 {
+
+// Итоги кредита с досрочными погашениями и каникулами
+struct CreditScenarioResult final {
+  CreditTotals totals;
+  // Фактический срок в месяцах, включая каникулы
+  int months = 0;
+  // Количество месяцев каникул и погашений, которые пришлись на срок
+  // кредита. 0 - события не изменили кредит
+  int events = 0;
+};
+
+class CreditScenario final {
+ public:
+  CreditScenario(double sum, int months, double interest,
+                 CreditModel::CreditType type,
+                 CreditModel::PaymentRounding rounding) noexcept;
+  CreditScenario(const CreditScenario& other) = delete;
+  CreditScenario(CreditScenario&& other) = delete;
+  CreditScenario& operator=(const CreditScenario& other) = delete;
+  CreditScenario& operator=(CreditScenario&& other) = delete;
+  ~CreditScenario() = default;
+
+  CreditScenarioResult Calculate(
+      const std::vector<CreditPrepayment>& prepayments,
+      const std::vector<CreditHoliday>& holidays,
+      CreditSchedule* schedule = nullptr);
+
+ private:
+  // Погашение и месяц его очередного повторения. Повторения не
+  // разворачиваются в отдельные события: после погашения месяц сдвигается на
+  // период
+  struct Repeat {
+    const CreditPrepayment* prepayment;
+    int next;
+  };
+
+  // Месяцы каникул с first по last. Пересекающиеся каникулы объединены
+  struct HolidayRange {
+    int first;
+    int last;
+  };
+
+  // Месяц события, которого нет
+  static constexpr int noEvent = std::numeric_limits<int>::max();
+
+  // Остаток меньше половины копейки считается ошибкой округления
+  const double balanceTolerance = 0.005;
+
+  void CollectEvents(const std::vector<CreditPrepayment>& prepayments,
+                     const std::vector<CreditHoliday>& holidays);
+  [[nodiscard]] int NextHoliday() noexcept;
+  [[nodiscard]] int NextRepeat(const Repeat* except = nullptr) const noexcept;
+  void ApplyPrepayments(int eventMonth);
+  void JumpRepeats(Repeat& repeat);
+  void Pay(int count);
+  void PayLast();
+  void SkipPayments(int count);
+  void Prepay(const CreditPrepayment& prepayment);
+  [[nodiscard]] int PaymentsFor(double debt) const noexcept;
+  void CountPayment(double payment) noexcept;
+  void AddPaid(double amount);
+  void AddRow(double payment, double principal, double interest);
+
+  double _sum;
+  int _months;
+  double _interest;
+  CreditModel::CreditType _type;
+  double monthInterest;
+  // Дифференцированные платежи округляются до копеек, как в CreditModel
+  bool roundPayments;
+
+  // Состояние расчета: прошедшие месяцы, остаток долга, оставшиеся платежи
+  // и текущий платеж - аннуитетный платеж или часть основного долга
+  int month;
+  double balance;
+  int paymentsLeft;
+  double payment;
+  CreditScenarioResult result;
+  // Общая выплата при округлении платежей
+  Money roundedTotal;
+  CreditSchedule* _schedule;
+
+  std::vector<Repeat> repeats;
+  std::vector<HolidayRange> holidayRanges;
+  // Первые каникулы, которые еще не закончились
+  std::size_t holidayIndex;
+};
+
+}  // namespace s21
+
+#endif  // SMARTCALCV2_CREDITSCENARIO_H
@@ -0,0 +1,42 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALCV2_CREDITSCHEDULE_H
+#define SMARTCALCV2_CREDITSCHEDULE_H
+
+#include <cstddef>
+#include <vector>
+
+namespace s21 {
+
+// График платежей по кредиту по столбцам: элемент i каждого столбца
+// относится к месяцу i + 1. Остаток долга - после платежа этого месяца
+struct CreditSchedule final {
+  std::vector<double> payments;
+  std::vector<double> principals;
+  std::vector<double> interests;
+  std::vector<double> balances;
+
+  [[nodiscard]] std::size_t Size() const noexcept { return payments.size(); }
+
+  // Выделенная память сохраняется, поэтому пересчет графика того же срока
+  // обходится без выделений
+  void Resize(std::size_t months) {
+    payments.resize(months);
+    principals.resize(months);
+    interests.resize(months);
+    balances.resize(months);
+  }
+
+  void Clear() noexcept {
+    payments.clear();
+    principals.clear();
+    interests.clear();
+    balances.clear();
+  }
+};
+
+}  // namespace s21
+
+#endif  // SMARTCALCV2_CREDITSCHEDULE_H
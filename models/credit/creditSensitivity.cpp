@@ -0,0 +1,117 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#include "creditSensitivity.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "../../helpers/parallelHelper.h"
+
+namespace s21 {
+
+/**
+ * @brief Рассчитывает сетку платежей и переплат по ставкам и срокам.
+ *
+ * Строки сетки - ставки, считаются параллельно блоками примерно по
+ * `blockCells` ячеек. Память сетки переиспользуется, поэтому пересчет сетки
+ * того же размера обходится без выделений.
+ *
+ * @param sum Сумма кредита.
+ * @param type Тип платежей.
+ * @param interestBegin Первая ставка в процентах годовых.
+ * @param interestEnd Последняя ставка, не меньше первой.
+ * @param rates Количество ставок, равномерно от первой до последней.
+ * @param monthsBegin Наименьший срок в месяцах.
+ * @param monthsEnd Наибольший срок, сроки идут с шагом в месяц.
+ * @param grid Сетка, в которую записывается результат.
+ * @param threads Количество потоков, 0 - по числу ядер.
+ * @throw FinanceSumException если сумма некорректна.
+ * @throw FinanceInterestException если диапазон ставок некорректен.
+ * @throw FinanceMonthException если диапазон сроков некорректен.
+ */
+void CreditSensitivity::Calculate(double sum, CreditModel::CreditType type,
+                                  double interestBegin, double interestEnd,
+                                  int rates, int monthsBegin, int monthsEnd,
+                                  CreditGrid& grid, unsigned threads) {
+  if (!CreditModel::CheckSum(sum)) {
+    throw FinanceSumException("Incorrect sum");
+  }
+
+  if (!CreditModel::CheckInterest(interestBegin) ||
+      !CreditModel::CheckInterest(interestEnd) ||
+      interestBegin > interestEnd || rates < 1 || rates > maxRates) {
+    throw FinanceInterestException("Incorrect interest range");
+  }
+
+  if (!CreditModel::CheckMonth(monthsBegin) ||
+      !CreditModel::CheckMonth(monthsEnd) || monthsBegin > monthsEnd) {
+    throw FinanceMonthException("Incorrect months range");
+  }
+
+  grid.interestBegin = interestBegin;
+  grid.interestEnd = interestEnd;
+  grid.rates = rates;
+  grid.monthsBegin = monthsBegin;
+  grid.monthsEnd = monthsEnd;
+
+  std::size_t cells = grid.Index(rates, 0);
+  grid.payments.resize(cells);
+  grid.overPayments.resize(cells);
+
+  auto terms = static_cast<std::size_t>(grid.Terms());
+  std::size_t grain = std::max<std::size_t>(blockCells / terms, 1);
+
+  parallelHelper::ParallelFor(
+      static_cast<std::size_t>(rates), grain,
+      [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+          CalculateRow(sum, type, static_cast<int>(i), grid);
+        }
+      },
+      threads);
+}
+
+/**
+ * @brief Рассчитывает строку сетки для одной ставки.
+ *
+ * У аннуитета x = S * (P + P / ((1 + P)^N - 1)). Величина (1 + P)^N - 1
+ * считается через expm1 только для первого срока, а для следующих - по
+ * рекуррентной формуле g(N + 1) = g(N) (1 + P) + P, поэтому строка
+ * считается без вызовов std::pow, а при малых ставках не теряет точность на
+ * вычитании единицы.
+ * У дифференцированного кредита первый платеж равен S / N + S P, переплата
+ * - S P (N + 1) / 2.
+ *
+ * @note Этот метод не бросает исключений (noexcept).
+ */
+void CreditSensitivity::CalculateRow(double sum, CreditModel::CreditType type,
+                                     int row, CreditGrid& grid) noexcept {
+  double monthInterest = grid.Interest(row) / (100 * 12);
+  int terms = grid.Terms();
+  double* payments = grid.payments.data() + grid.Index(row, 0);
+  double* overPayments = grid.overPayments.data() + grid.Index(row, 0);
+
+  if (type == CreditModel::Differentiated) {
+    for (int j = 0; j < terms; ++j) {
+      double months = grid.Months(j);
+      payments[j] = sum / months + sum * monthInterest;
+      overPayments[j] = sum * monthInterest * (months + 1) / 2;
+    }
+
+    return;
+  }
+
+  // (1 + P)^N - 1 без вычитания близких чисел
+  double growth = std::expm1(grid.monthsBegin * std::log1p(monthInterest));
+
+  for (int j = 0; j < terms; ++j) {
+    double monthPay = sum * (monthInterest + monthInterest / growth);
+    payments[j] = monthPay;
+    overPayments[j] = monthPay * grid.Months(j) - sum;
+    growth += growth * monthInterest + monthInterest;
+  }
+}
+
+}  // namespace s21
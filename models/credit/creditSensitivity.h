@@ -0,0 +1,37 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALCV2_CREDITSENSITIVITY_H
+#define SMARTCALCV2_CREDITSENSITIVITY_H
+
+#include <cstddef>
+
+#include "creditGrid.h"
+#include "creditModel.h"
+
+namespace s21 {
+
+class CreditSensitivity final {
+ public:
+  CreditSensitivity() = delete;
+
+  // Наибольшее количество ставок в сетке
+  static constexpr int maxRates = 1000;
+
+  static void Calculate(double sum, CreditModel::CreditType type,
+                        double interestBegin, double interestEnd, int rates,
+                        int monthsBegin, int monthsEnd, CreditGrid& grid,
+                        unsigned threads = 0);
+
+ private:
+  // Примерно столько ячеек считаются в одном потоке за раз
+  static constexpr std::size_t blockCells = 4096;
+
+  static void CalculateRow(double sum, CreditModel::CreditType type, int row,
+                           CreditGrid& grid) noexcept;
+};
+
+}  // namespace s21
+
+#endif  // SMARTCALCV2_CREDITSENSITIVITY_H
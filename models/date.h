@@ -0,0 +1,180 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALC_DATE_H
+#define SMARTCALC_DATE_H
+
+namespace s21 {
+
+// Таблица номеров первых дней месяцев, день 0 - 01.01.1900. Годы до 2150
+// включительно покрывают самый длинный вклад, открытый в 2100 году
+struct DateTable final {
+  static constexpr int minYear = 1900;
+  static constexpr int maxYear = 2150;
+  static constexpr int months = (maxYear - minYear + 1) * 12;
+
+  constexpr DateTable() : monthBegin() {
+    const int days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+    for (int i = 0; i < months; ++i) {
+      int year = minYear + i / 12;
+      int month = i % 12;
+      bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+      monthBegin[i + 1] = monthBegin[i] + days[month] + (month == 1 && leap);
+    }
+  }
+
+  // Последний элемент - номер дня, следующего за концом таблицы
+  int monthBegin[months + 1];
+};
+
+inline constexpr DateTable dateTable{};
+
+// Дата как номер дня с 01.01.1900. Сравнение, разность дат и сдвиг на дни -
+// целочисленные операции, перевод в год, месяц и день и переход на месяцы
+// выполняются по таблице за O(1)
+class Date final {
+ public:
+  static constexpr int minYear = DateTable::minYear;
+  static constexpr int maxYear = DateTable::maxYear;
+
+  constexpr Date() noexcept : serial(0) {}
+
+  /**
+   * @brief Проверяет, что дата существует и входит в диапазон таблицы.
+   */
+  [[nodiscard]] static constexpr bool IsValid(int year, int month,
+                                              int day) noexcept {
+    return year >= minYear && year <= maxYear && month >= 1 && month <= 12 &&
+           day >= 1 && day <= DaysInMonth(year, month);
+  }
+
+  /**
+   * @brief Создает дату по году, месяцу и дню. Дата должна быть корректной,
+   * см. IsValid().
+   */
+  [[nodiscard]] static constexpr Date FromYmd(int year, int month,
+                                              int day) noexcept {
+    return Date(dateTable.monthBegin[MonthIndex(year, month)] + day - 1);
+  }
+
+  [[nodiscard]] static constexpr Date FromSerial(int serial) noexcept {
+    return Date(serial);
+  }
+
+  /**
+   * @brief Возвращает количество дней в месяце года из диапазона таблицы.
+   */
+  [[nodiscard]] static constexpr int DaysInMonth(int year,
+                                                 int month) noexcept {
+    int index = MonthIndex(year, month);
+    return dateTable.monthBegin[index + 1] - dateTable.monthBegin[index];
+  }
+
+  [[nodiscard]] static constexpr bool IsLeapYear(int year) noexcept {
+    return DaysInMonth(year, 2) == 29;
+  }
+
+  [[nodiscard]] constexpr int Serial() const noexcept { return serial; }
+  [[nodiscard]] constexpr int Year() const noexcept {
+    return minYear + SerialMonthIndex() / 12;
+  }
+  [[nodiscard]] constexpr int Month() const noexcept {
+    return SerialMonthIndex() % 12 + 1;
+  }
+  [[nodiscard]] constexpr int Day() const noexcept {
+    return serial - dateTable.monthBegin[SerialMonthIndex()] + 1;
+  }
+  [[nodiscard]] constexpr int DaysInMonth() const noexcept {
+    int index = SerialMonthIndex();
+    return dateTable.monthBegin[index + 1] - dateTable.monthBegin[index];
+  }
+
+  /**
+   * @brief Возвращает первый день месяца даты.
+   */
+  [[nodiscard]] constexpr Date MonthBegin() const noexcept {
+    return Date(dateTable.monthBegin[SerialMonthIndex()]);
+  }
+
+  /**
+   * @brief Сдвигает дату на месяцы. День, которого нет в новом месяце,
+   * заменяется последним днем месяца. Результат должен входить в диапазон
+   * таблицы.
+   */
+  [[nodiscard]] constexpr Date AddMonths(int months) const noexcept {
+    int index = SerialMonthIndex() + months;
+    int begin = dateTable.monthBegin[index];
+    int days = dateTable.monthBegin[index + 1] - begin;
+    int day = Day();
+    return Date(begin + (day < days ? day : days) - 1);
+  }
+
+  friend constexpr Date operator+(Date date, int days) noexcept {
+    return Date(date.serial + days);
+  }
+
+  friend constexpr Date operator-(Date date, int days) noexcept {
+    return Date(date.serial - days);
+  }
+
+  friend constexpr int operator-(Date lhs, Date rhs) noexcept {
+    return lhs.serial - rhs.serial;
+  }
+
+  friend constexpr bool operator==(Date lhs, Date rhs) noexcept {
+    return lhs.serial == rhs.serial;
+  }
+
+  friend constexpr bool operator!=(Date lhs, Date rhs) noexcept {
+    return lhs.serial != rhs.serial;
+  }
+
+  friend constexpr bool operator<(Date lhs, Date rhs) noexcept {
+    return lhs.serial < rhs.serial;
+  }
+
+  friend constexpr bool operator>(Date lhs, Date rhs) noexcept {
+    return lhs.serial > rhs.serial;
+  }
+
+  friend constexpr bool operator<=(Date lhs, Date rhs) noexcept {
+    return lhs.serial <= rhs.serial;
+  }
+
+  friend constexpr bool operator>=(Date lhs, Date rhs) noexcept {
+    return lhs.serial >= rhs.serial;
+  }
+
+ private:
+  explicit constexpr Date(int newSerial) noexcept : serial(newSerial) {}
+
+  static constexpr int MonthIndex(int year, int month) noexcept {
+    return (year - minYear) * 12 + month - 1;
+  }
+
+  /**
+   * @brief Находит месяц даты: оценка по средней длине месяца ошибается не
+   * больше чем на один месяц и уточняется по таблице.
+   */
+  [[nodiscard]] constexpr int SerialMonthIndex() const noexcept {
+    // В 400 годах 4800 месяцев и 146097 дней
+    int index = serial * 4800 / 146097;
+
+    if (index >= DateTable::months ||
+        (index > 0 && dateTable.monthBegin[index] > serial)) {
+      --index;
+    } else if (dateTable.monthBegin[index + 1] <= serial) {
+      ++index;
+    }
+
+    return index;
+  }
+
+  int serial;
+};
+
+}  // namespace s21
+
+#endif  // SMARTCALC_DATE_H
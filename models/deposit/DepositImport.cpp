@@ -0,0 +1,376 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#include "DepositImport.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#ifdef _WIN32
+#include <fstream>
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "../financeException.h"
+
+namespace s21 {
+
+namespace {
+
+/**
+ * @brief Файл, отображенный в память только для чтения. Выписка не
+ * копируется в память процесса, а читается страницами по мере разбора. Где
+ * отображения нет, файл читается целиком.
+ */
+class MappedFile final {
+ public:
+  explicit MappedFile(const std::string& path);
+  MappedFile(const MappedFile& other) = delete;
+  MappedFile(MappedFile&& other) = delete;
+  MappedFile& operator=(const MappedFile& other) = delete;
+  MappedFile& operator=(MappedFile&& other) = delete;
+  ~MappedFile();
+
+  [[nodiscard]] std::string_view Text() const noexcept { return text; }
+
+ private:
+  std::string_view text;
+#ifdef _WIN32
+  std::string buffer;
+#else
+  void* data = nullptr;
+#endif
+};
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+
+  if (!file) {
+    throw FinanceImportException("Cannot read file", 0);
+  }
+
+  buffer.assign(std::istreambuf_iterator<char>(file),
+                std::istreambuf_iterator<char>());
+  text = buffer;
+}
+
+MappedFile::~MappedFile() = default;
+
+#else
+
+MappedFile::MappedFile(const std::string& path) {
+  int descriptor = open(path.c_str(), O_RDONLY);
+  struct stat info {};
+
+  if (descriptor < 0 || fstat(descriptor, &info) != 0) {
+    if (descriptor >= 0) {
+      close(descriptor);
+    }
+
+    throw FinanceImportException("Cannot read file", 0);
+  }
+
+  auto size = static_cast<std::size_t>(info.st_size);
+
+  if (size > 0) {
+    data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+  }
+
+  // Отображение остается действительным и после закрытия файла
+  close(descriptor);
+
+  if (data == MAP_FAILED) {
+    data = nullptr;
+    throw FinanceImportException("Cannot read file", 0);
+  }
+
+  if (data != nullptr) {
+    madvise(data, size, MADV_SEQUENTIAL);
+    text = std::string_view(static_cast<const char*>(data), size);
+  }
+}
+
+MappedFile::~MappedFile() {
+  if (data != nullptr) {
+    munmap(data, text.size());
+  }
+}
+
+#endif
+
+}  // namespace
+
+/**
+ * @brief Разбирает таблицу операций.
+ *
+ * Текст разбирается за один проход без копирования строк, поэтому выписка
+ * на десятки тысяч операций загружается за миллисекунды.
+ *
+ * @param text Содержимое файла в UTF-8, возможно с BOM.
+ * @return Операции в порядке строк файла.
+ * @throw FinanceImportException если строка после заголовка не содержит
+ * корректной даты или суммы.
+ */
+std::vector<DepositOperation> DepositImport::Parse(std::string_view text) {
+  const std::string_view bom = "\xEF\xBB\xBF";
+
+  if (text.substr(0, bom.size()) == bom) {
+    text.remove_prefix(bom.size());
+  }
+
+  std::vector<DepositOperation> operations;
+  operations.reserve(
+      static_cast<std::size_t>(std::count(text.begin(), text.end(), '\n')) +
+      1);
+
+  char separator = 0;
+  std::size_t lineNumber = 0;
+  std::size_t pos = 0;
+
+  while (pos < text.size()) {
+    std::size_t end = std::min(text.find('\n', pos), text.size());
+    std::string_view line = text.substr(pos, end - pos);
+    pos = end + 1;
+    ++lineNumber;
+
+    if (!line.empty() && line.back() == '\r') {
+      line.remove_suffix(1);
+    }
+
+    if (line.find_first_not_of(" \t") == std::string_view::npos) {
+      continue;
+    }
+
+    bool isFirst = separator == 0;
+
+    if (isFirst) {
+      separator = line.find('\t') != std::string_view::npos   ? '\t'
+                  : line.find(';') != std::string_view::npos ? ';'
+                                                             : ',';
+    }
+
+    DepositOperation operation;
+
+    if (ParseLine(line, separator, operation)) {
+      operations.push_back(operation);
+    } else if (!isFirst ||
+               line.find_first_of("0123456789") != std::string_view::npos) {
+      throw FinanceImportException("Incorrect operation line", lineNumber);
+    }
+  }
+
+  return operations;
+}
+
+/**
+ * @brief Загружает операции из файла таблицы.
+ *
+ * @param path Путь к файлу.
+ * @return Операции в порядке строк файла.
+ * @throw FinanceImportException если файл не удалось прочитать или он
+ * содержит некорректную строку.
+ */
+std::vector<DepositOperation> DepositImport::ReadFile(
+    const std::string& path) {
+  MappedFile file(path);
+  return Parse(file.Text());
+}
+
+/**
+ * @brief Разбирает дату и сумму из первых двух столбцов строки.
+ *
+ * В таблице с разделителем-запятой целая сумма без кавычек, за которой идет
+ * столбец из одной-двух цифр, считается ошибкой: это сумма с копейками
+ * через запятую, и копейки потерялись бы в следующем столбце.
+ */
+bool DepositImport::ParseLine(std::string_view line, char separator,
+                              DepositOperation& operation) noexcept {
+  std::size_t pos = 0;
+  std::string_view date = NextField(line, pos, separator);
+
+  if (pos > line.size()) {
+    return false;
+  }
+
+  std::size_t amountBegin = line.find_first_not_of(' ', pos);
+  std::string_view amount = NextField(line, pos, separator);
+
+  if (!ParseDate(date, operation) || !ParseAmount(amount, operation.amount)) {
+    return false;
+  }
+
+  bool isQuoted =
+      amountBegin != std::string_view::npos && line[amountBegin] == '"';
+
+  if (separator == ',' && !isQuoted && pos <= line.size() &&
+      amount.find('.') == std::string_view::npos) {
+    std::string_view next = NextField(line, pos, separator);
+    int kopecks;
+    return next.size() > 2 || !ParseNumber(next, kopecks);
+  }
+
+  return true;
+}
+
+/**
+ * @brief Разбирает дату вида ГГГГ-ММ-ДД или ДД.ММ.ГГГГ. Дата должна
+ * существовать.
+ */
+bool DepositImport::ParseDate(std::string_view field,
+                              DepositOperation& operation) noexcept {
+  if (field.size() != 10) {
+    return false;
+  }
+
+  bool isCorrect;
+
+  if (field[4] == '-' && field[7] == '-') {
+    isCorrect = ParseNumber(field.substr(0, 4), operation.year) &&
+                ParseNumber(field.substr(5, 2), operation.month) &&
+                ParseNumber(field.substr(8, 2), operation.day);
+  } else if (field[2] == '.' && field[5] == '.') {
+    isCorrect = ParseNumber(field.substr(0, 2), operation.day) &&
+                ParseNumber(field.substr(3, 2), operation.month) &&
+                ParseNumber(field.substr(6, 4), operation.year);
+  } else {
+    isCorrect = false;
+  }
+
+  return isCorrect &&
+         Date::IsValid(operation.year, operation.month, operation.day);
+}
+
+/**
+ * @brief Разбирает ненулевую сумму в рублях не больше чем с двумя знаками
+ * после точки или запятой. Запятая внутри столбца всегда десятичная: в
+ * таблице с разделителем-запятой такая сумма записывается в кавычках. Сумма
+ * собирается в копейках, поэтому не зависит от локали и не теряет
+ * точности.
+ */
+bool DepositImport::ParseAmount(std::string_view field,
+                                double& amount) noexcept {
+  bool negative = false;
+
+  if (!field.empty() && (field[0] == '-' || field[0] == '+')) {
+    negative = field[0] == '-';
+    field.remove_prefix(1);
+  }
+
+  std::size_t point = field.find_first_of(".,");
+  std::string_view whole = field.substr(0, point);
+  std::string_view fraction = point == std::string_view::npos
+                                  ? std::string_view()
+                                  : field.substr(point + 1);
+
+  if (fraction.size() > 2) {
+    return false;
+  }
+
+  std::int64_t kopecks = 0;
+  std::size_t digits = 0;
+
+  // Пробелы разделяют разряды, как в выписках банков: 1 000 000,00
+  for (char digit : whole) {
+    if (digit == ' ') {
+      continue;
+    }
+
+    if (digit < '0' || digit > '9' || ++digits > maxAmountDigits) {
+      return false;
+    }
+
+    kopecks = kopecks * 10 + (digit - '0');
+  }
+
+  if (digits == 0) {
+    return false;
+  }
+
+  for (std::size_t i = 0; i < 2; ++i) {
+    char digit = i < fraction.size() ? fraction[i] : '0';
+
+    if (digit < '0' || digit > '9') {
+      return false;
+    }
+
+    kopecks = kopecks * 10 + (digit - '0');
+  }
+
+  if (kopecks == 0) {
+    return false;
+  }
+
+  amount = static_cast<double>(negative ? -kopecks : kopecks) / 100;
+  return true;
+}
+
+/**
+ * @brief Разбирает неотрицательное целое число из одних цифр.
+ */
+bool DepositImport::ParseNumber(std::string_view field, int& value) noexcept {
+  value = 0;
+
+  for (char digit : field) {
+    if (digit < '0' || digit > '9') {
+      return false;
+    }
+
+    value = value * 10 + (digit - '0');
+  }
+
+  return !field.empty();
+}
+
+/**
+ * @brief Выделяет следующий столбец строки без пробелов по краям и кавычек.
+ *
+ * @param line Строка.
+ * @param pos Начало столбца. После вызова - начало следующего столбца или
+ * позиция за концом строки, если столбцов больше нет.
+ * @param separator Разделитель столбцов.
+ * @return Содержимое столбца.
+ */
+std::string_view DepositImport::NextField(std::string_view line,
+                                          std::size_t& pos,
+                                          char separator) noexcept {
+  auto trim = [](std::string_view field) {
+    std::size_t first = field.find_first_not_of(' ');
+
+    if (first == std::string_view::npos) {
+      return std::string_view();
+    }
+
+    return field.substr(first, field.find_last_not_of(' ') - first + 1);
+  };
+
+  std::size_t begin = std::min(pos, line.size());
+  std::size_t quote = line.find_first_not_of(' ', begin);
+  bool isQuoted = quote != std::string_view::npos && line[quote] == '"';
+  std::string_view field;
+
+  // Разделитель внутри кавычек не отделяет столбцы
+  if (isQuoted) {
+    std::size_t closing = std::min(line.find('"', quote + 1), line.size());
+    field = line.substr(quote + 1, closing - quote - 1);
+    begin = closing;
+  }
+
+  std::size_t end = std::min(line.find(separator, begin), line.size());
+
+  if (!isQuoted) {
+    field = line.substr(begin, end - begin);
+  }
+
+  pos = end + 1;
+  return trim(field);
+}
+
+}  // namespace s21
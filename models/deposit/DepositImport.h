@@ -0,0 +1,46 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALCV2_DEPOSITIMPORT_H
+#define SMARTCALCV2_DEPOSITIMPORT_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "DepositOperations.h"
+
+namespace s21 {
+
+// Загрузка пополнений и снятий из таблицы CSV или TSV. В каждой строке
+// первый столбец - дата в виде ГГГГ-ММ-ДД или ДД.ММ.ГГГГ, второй - сумма,
+// отрицательная для снятия; остальные столбцы пропускаются. Разделитель
+// столбцов - табуляция, точка с запятой или запятая, определяется по первой
+// непустой строке. При разделителе-запятой сумма с копейками через запятую
+// записывается в кавычках. Первая строка без цифр считается заголовком
+class DepositImport final {
+ public:
+  DepositImport() = delete;
+
+  static std::vector<DepositOperation> Parse(std::string_view text);
+  static std::vector<DepositOperation> ReadFile(const std::string& path);
+
+ private:
+  // Сумма с большим количеством цифр превышает точность double в копейках
+  static constexpr std::size_t maxAmountDigits = 15;
+
+  static bool ParseLine(std::string_view line, char separator,
+                        DepositOperation& operation) noexcept;
+  static bool ParseDate(std::string_view field,
+                        DepositOperation& operation) noexcept;
+  static bool ParseAmount(std::string_view field, double& amount) noexcept;
+  static bool ParseNumber(std::string_view field, int& value) noexcept;
+  static std::string_view NextField(std::string_view line, std::size_t& pos,
+                                    char separator) noexcept;
+};
+
+}  // namespace s21
+
+#endif  // SMARTCALCV2_DEPOSITIMPORT_H
@@ -4,12 +4,69 @@
 
 #include "DepositModel.h"
 
+#include <algorithm>
 #include <cmath>
+#include <iterator>
 
-#include "../../helpers/mathHelper.h"
+#include "DepositImport.h"
 
 namespace s21 {
 
+namespace {
+
+// Пополнения и снятия за один день
+struct DepositEvent {
+  Date date;
+  Money amount;
+};
+
+/**
+ * @brief Сливает операции двух хранилищ с датами из отрезка [from, to] и
+ * объединяет операции одного дня.
+ */
+std::vector<DepositEvent> MakeEvents(const DepositOperations& operations,
+                                     const DepositOperations& imported,
+                                     Date from, Date to) {
+  auto [operationsBegin, operationsEnd] = operations.Range(from, to);
+  auto [importedBegin, importedEnd] = imported.Range(from, to);
+  std::vector<DepositEvent> events;
+  events.reserve(
+      static_cast<std::size_t>(std::distance(operationsBegin, operationsEnd) +
+                               std::distance(importedBegin, importedEnd)));
+
+  for (auto item = operationsBegin; item != operationsEnd; ++item) {
+    events.push_back({Date::FromYmd(item->year, item->month, item->day),
+                      Money::FromDouble(item->amount)});
+  }
+
+  auto middle = static_cast<std::ptrdiff_t>(events.size());
+
+  for (auto item = importedBegin; item != importedEnd; ++item) {
+    events.push_back({Date::FromYmd(item->year, item->month, item->day),
+                      Money::FromDouble(item->amount)});
+  }
+
+  std::inplace_merge(events.begin(), events.begin() + middle, events.end(),
+                     [](const DepositEvent& lhs, const DepositEvent& rhs) {
+                       return lhs.date < rhs.date;
+                     });
+
+  std::size_t count = 0;
+
+  for (const DepositEvent& event : events) {
+    if (count > 0 && events[count - 1].date == event.date) {
+      events[count - 1].amount += event.amount;
+    } else {
+      events[count++] = event;
+    }
+  }
+
+  events.resize(count);
+  return events;
+}
+
+}  // namespace
+
 /**
  * @brief Конструктор класса DepositModel.
  *
@@ -23,10 +80,12 @@ DepositModel::DepositModel() noexcept
       _tax(13),
       payPeriod(),
       _capitalization(false),
+      accrual(PerDay),
       yearStart(0),
       monthStart(0),
       dayStart(0),
-      operationsList({}),
+      operationsList(),
+      importedList(),
       _isCalc(false),
       interestAmount(0),
       depositAmount(0),
@@ -45,6 +104,23 @@ void DepositModel::CalculateDeposit() {
   CalculateHandle();
 }
 
+/**
+ * @brief Загружает пополнения и снятия из файла CSV или TSV вместо
+ * загруженных ранее.
+ *
+ * @param path Путь к файлу.
+ * @return Количество загруженных операций.
+ * @throw s21::FinanceImportException если файл не удалось прочитать или он
+ * содержит некорректную строку. Загруженные ранее операции тогда остаются.
+ */
+std::size_t DepositModel::ImportOperations(const std::string& path) {
+  std::vector<DepositOperation> operations = DepositImport::ReadFile(path);
+  importedList.Clear();
+  importedList.Add(std::move(operations));
+  _isCalc = false;
+  return importedList.Size();
+}
+
 /**
  * @brief Сбрасывает результаты модели депозита.
  */
@@ -137,9 +213,8 @@ bool DepositModel::CheckInterest() const noexcept {
  * @note Этот метод не бросает исключений (noexcept).
  */
 bool DepositModel::CheckDate(int year, int month, int day) const noexcept {
-  return !(year < minDepositYear || year > maxDepositYear || month < 1 ||
-           month > 12 || day < 1 || day > 31 ||
-           day > mathHelper::GetDaysCount(month, year));
+  return !(year < minDepositYear || year > maxDepositYear ||
+           !Date::IsValid(year, month, day));
 }
 
 /**
@@ -150,8 +225,8 @@ bool DepositModel::CheckDate(int year, int month, int day) const noexcept {
  * Если какая-либо операция некорректна, метод выбрасывает исключение.
  */
 void DepositModel::CheckOperations() const {
-  if (!operationsList.empty()) {
-    for (const auto& i : operationsList) {
+  for (const DepositOperations* operations : {&operationsList, &importedList}) {
+    for (const auto& i : *operations) {
       if (!CheckSum(std::fabs(i.amount))) {
         if (std::signbit(i.amount)) {
           throw s21::FinanceDateOperationMinusException(
@@ -182,120 +257,138 @@ void DepositModel::CheckOperations() const {
  * процентов, общая сумма вклада и общий налог на доход. Результаты записываются
  * в соответствующие поля класса.
  *
+ * Операции сортируются по дате и объединяются по дням. Внутри месяца сумма
+ * на вкладе меняется только в дни операций, поэтому проценты между
+ * соседними операциями начисляются сразу за весь промежуток без поиска
+ * операций по каждому дню. Результат совпадает с посуточным расчетом до
+ * копейки, включая момент проверки остатка.
+ *
  * @throws s21::FinanceDateStartException Если указана некорректная дата начала
  * вклада.
  * @throws s21::FinanceOperationNoMoneyException Если на вкладе недостаточно
  * средств для проведения операции.
  */
 void DepositModel::CalculateHandle() {
-  int startYear = yearStart;
-  int startMonth = monthStart;
-  int startDay = dayStart;
-
-  if (!CheckDate(startYear, startMonth,
-                 startDay)) {
+  if (!CheckDate(yearStart, monthStart,
+                 dayStart)) {
     throw s21::FinanceDateStartException("Incorrect date start");
   }
 
-  double totalInterestPayment = 0;  // Общая сумма выплаты процентов
+  Date start = Date::FromYmd(yearStart, monthStart, dayStart);
+  int startDay = dayStart;
+
+  // Суммы на вкладе, выплаченные проценты и налог хранятся в копейках,
+  // в double остаются только неокругленные начисления
+  Money totalInterestPayment;  // Общая сумма выплаты процентов
+  double endInterestPayment = 0;  // Проценты к выплате в конце срока
   double totalInterestPaymentForTax = 0;  // Общая сумма выплаты процентов для налога
-  double totalSum = _sum;  // Общая сумма вклада
-  double totalTax = 0;         // Общий налог на доход
+  Money totalSum = Money::FromDouble(_sum);  // Общая сумма вклада
+  Money totalTax;  // Общий налог на доход
 
   double pd = _interest / (100 * 365);
   double pdv =
       _interest / (100 * 366);  // Расчет процентной ставки на високосный день
 
+  // Операции до дня начала и после конца срока не проводятся
+  std::vector<DepositEvent> events = MakeEvents(
+      operationsList, importedList, start, start.AddMonths(_months));
+  auto event = events.begin();
+
+  // Проводит операции за день и переходит к следующему дню с операциями
+  auto handleEvent = [&](Date date) {
+    if (event != events.end() && event->date == date) {
+      totalSum += event->amount;
+      ++event;
+    }
+  };
+
   int counter = _months;  // Устанавливаем счетчик на количество месяцев
+  Date month = start.MonthBegin();  // Первый день текущего месяца
 
   while (counter >= 0) {
-    int numDays = mathHelper::GetDaysCount(
-        startMonth, startYear);
-    int paymentDays = 0;  // Счетчик дней выплат
+    int numDays = month.DaysInMonth();
+    // Ставка за день зависит только от года, поэтому считается раз в месяц
+    double dayRate = Date::IsLeapYear(month.Year()) ? pdv : pd;
+    Date monthDate = month - 1;  // Дата дня месяца - смещение от monthDate
+    int firstDay = 1;  // Первый день начисления процентов
+    int lastDay = numDays;  // Последний день начисления процентов
     double monthSum = 0;  // Общая сумма за месяц
+    Money monthPayment;   // Выплата процентов за месяц
 
-    for (int day = 1; day <= numDays; ++day) {  // Проходим по всем дням месяца
-      if (totalSum < 0) {
+    if (counter == _months) {  // Если это первый месяц
+      // В день начала операции проводятся без начисления процентов
+      handleEvent(monthDate + startDay);
+
+      // Остаток проверяется в начале следующего дня, в конце месяца -
+      // после капитализации
+      if (startDay < numDays && totalSum < Money()) {
         throw s21::FinanceOperationNoMoneyException("No money :(");
       }
 
-      if (counter == _months) {  // Если это первый месяц
-        if (day <= startDay) {  // Если еще не наступил день начала
-          if (day == startDay) {  // Если сегодня день начала
-            OperationsHandle(startYear, startMonth, day,
-                             totalSum);  // Обрабатываем операции
-          }
-
-          continue;
-        }
-      }
+      firstDay = startDay + 1;
+    }
 
-      if (counter == 0) {      // Если это последний месяц
-        if (day > startDay) {  // Если уже прошел день начала
-          continue;
-        }
-      }
+    if (counter == 0) {  // Если это последний месяц
+      lastDay = std::min(startDay, numDays);
+    }
 
-      double percentSum;
+    for (int day = firstDay; day <= lastDay;) {
+      // Проценты до ближайшего дня с операциями начисляются на одну сумму
+      int segmentEnd = lastDay;
 
-      if (mathHelper::GetDaysCount(2, startYear) ==
-          29) {                       // Если год високосный
-        percentSum = pdv * totalSum;  // Рассчитываем процентную сумму
-      } else {
-        percentSum = pd * totalSum;  // Иначе рассчитываем процентную сумму
+      if (event != events.end() && event->date <= monthDate + lastDay) {
+        segmentEnd = event->date - monthDate;
       }
 
-      if (payPeriod == Day) {  // Если период выплаты - ежедневно
-        percentSum = mathHelper::Round(
-            percentSum, 2);  // Округляем сумму до двух знаков после запятой
+      AccrueInterest(segmentEnd - day + 1, dayRate, totalSum, monthPayment,
+                     monthSum);
+      handleEvent(monthDate + segmentEnd);
 
-        if (_capitalization) {  // Если проценты капитализируются
-          totalSum += percentSum;  // Добавляем проценты к общей сумме
-        }
+      if (segmentEnd < numDays && totalSum < Money()) {
+        throw s21::FinanceOperationNoMoneyException("No money :(");
       }
 
-      monthSum +=
-          percentSum;  // Добавляем проценты за день к общей сумме за месяц
-      ++paymentDays;  // Увеличиваем количество дней выплат
-
-      OperationsHandle(startYear, startMonth, day,
-                       totalSum);  // Обрабатываем операции
+      day = segmentEnd + 1;
     }
 
     if (payPeriod == Month) {  // Если период выплаты - ежемесячно
-      monthSum = mathHelper::Round(
-          monthSum,
-          2);  // Округляем сумму за месяц до двух знаков после запятой
+      monthPayment = Money::FromDouble(
+          monthSum);  // Округляем сумму за месяц до копеек
 
       if (_capitalization) {  // Если проценты капитализируют
-        totalSum += monthSum;  // Добавляем проценты за месяц к общей сумме
+        totalSum += monthPayment;  // Добавляем проценты за месяц к общей сумме
       }
     }
 
-    totalInterestPayment +=
-        monthSum;  // Добавляем сумму за месяц к общей сумме выплаты процентов
-    totalInterestPaymentForTax += monthSum;
-
-    ++startMonth;  // Увеличиваем месяц на один
+    if (counter > 0 && totalSum < Money()) {
+      throw s21::FinanceOperationNoMoneyException("No money :(");
+    }
 
-    if (startMonth == 13) {  // Если месяц стал больше 12
-      startMonth = 1;  // Устанавливаем месяц в январь
-      ++startYear;     // Увеличиваем год
+    if (payPeriod == End) {  // Проценты за месяц копятся без округления
+      endInterestPayment += monthSum;
+      totalInterestPaymentForTax += monthSum;
+    } else {
+      // Добавляем сумму за месяц к общей сумме выплаты процентов
+      totalInterestPayment += monthPayment;
+      totalInterestPaymentForTax += monthPayment.ToDouble();
+    }
 
+    if (month.Month() == 12) {  // Если закончился год
       if (totalInterestPaymentForTax > 160000) {
-        totalTax += mathHelper::Round((totalInterestPaymentForTax - 1000000 * 0.16) * (_tax / 100),
-                                     2);
+        totalTax += Money::FromDouble(
+            (totalInterestPaymentForTax - 1000000 * 0.16) * (_tax / 100));
         totalInterestPaymentForTax = 0;
       }
     }
 
+    month = month + numDays;  // Переходим к следующему месяцу
     --counter;  // Уменьшаем счетчик
   }
 
   if (payPeriod == End) {  // Если период выплаты - в конце срока
-    totalInterestPayment = mathHelper::Round(
-        totalInterestPayment, 2);  // Округляем общую сумму выплаты процентов до
-                                   // двух знаков после запятой
+    totalInterestPayment = Money::FromDouble(
+        endInterestPayment);  // Округляем общую сумму выплаты процентов до
+                              // копеек
 
     if (_capitalization) {  // Если проценты капитализируют
       totalSum += totalInterestPayment;  // Добавляем общую сумму выплаты
@@ -304,37 +397,67 @@ void DepositModel::CalculateHandle() {
   }
 
   if (totalInterestPaymentForTax > 160000) {
-    totalTax += mathHelper::Round((totalInterestPaymentForTax - 1000000 * 0.16) * (_tax / 100),
-                                 2);
+    totalTax += Money::FromDouble(
+        (totalInterestPaymentForTax - 1000000 * 0.16) * (_tax / 100));
   }
 
-  interestAmount =
-      totalInterestPayment;  // Записываем общую сумму выплаты процентов
-  depositAmount = totalSum;  // Записываем общую сумму вклада
-  taxAmount = totalTax;  // Записываем общий налог на доход
+  // Записываем общую сумму выплаты процентов
+  interestAmount = totalInterestPayment.ToDouble();
+  depositAmount = totalSum.ToDouble();  // Записываем общую сумму вклада
+  taxAmount = totalTax.ToDouble();  // Записываем общий налог на доход
   _isCalc = true;  // Устанавливаем флаг завершения расчетов
 }
 
 /**
- * @brief Обрабатывает операции в указанную дату.
+ * @brief Начисляет проценты за несколько дней подряд, в которые сумма на
+ * вкладе меняется только капитализацией.
  *
- * Этот метод ищет операции в списке операций для указанной даты
- * и добавляет их суммы к общей сумме.
+ * Без ежедневной капитализации проценты за каждый день одинаковые. При
+ * ежедневной выплате они начисляются одним умножением в копейках.
+ * При начислении PerDay неокругленные проценты складываются по одному дню,
+ * как при посуточном расчете: произведение на количество дней отличается в
+ * последних битах и может сдвинуть округление до копеек. Ежедневная
+ * капитализация округляется каждый день, поэтому такие дни тоже считаются
+ * по одному. При начислении PerSpan проценты за промежуток считаются за
+ * O(1): произведением на количество дней, а при ежедневной капитализации -
+ * по формуле сложных процентов S ((1 + r)^n - 1) с одним округлением.
  *
- * @param year Год операции.
- * @param month Месяц операции.
- * @param day День операции.
- * @param total_sum Общая сумма, к которой добавляются суммы операций.
+ * @param days Количество дней.
+ * @param dayRate Процентная ставка за день.
+ * @param totalSum Сумма на вкладе.
+ * @param monthPayment Выплата процентов за месяц при ежедневной выплате.
+ * @param monthSum Неокругленные проценты за месяц при остальных выплатах.
+ * @throw FinanceOverflowException если сумма на вкладе не помещается в
+ * копейки.
  */
-void DepositModel::OperationsHandle(int year, int month, int day,
-                                    double& total_sum) const {
-  if (!operationsList.empty()) {
-    for (const auto& item : operationsList) {
-      if (year == item.year && month == item.month && day == item.day) {
-        total_sum += item.amount;
-      }
+void DepositModel::AccrueInterest(int days, double dayRate, Money& totalSum,
+                                  Money& monthPayment,
+                                  double& monthSum) const {
+  if (payPeriod != Day) {
+    double percentSum = dayRate * totalSum.ToDouble();
+
+    if (accrual == PerSpan) {
+      monthSum += percentSum * days;
+      return;
+    }
+
+    for (int day = 0; day < days; ++day) {
+      monthSum += percentSum;
+    }
+  } else if (!_capitalization) {
+    monthPayment += Money::FromDouble(dayRate * totalSum.ToDouble()) * days;
+  } else if (accrual == PerSpan) {
+    Money spanPayment = Money::FromDouble(
+        totalSum.ToDouble() * std::expm1(days * std::log1p(dayRate)));
+    monthPayment += spanPayment;
+    totalSum += spanPayment;
+  } else {
+    for (int day = 0; day < days; ++day) {
+      Money dayPayment = Money::FromDouble(dayRate * totalSum.ToDouble());
+      monthPayment += dayPayment;
+      totalSum += dayPayment;
     }
   }
 }
 
-}  // namespace s21
\ No newline at end of file
+}  // namespace s21
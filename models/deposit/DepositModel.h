@@ -5,27 +5,19 @@
 #ifndef SMARTCALCV2_DEPOSITMODEL_H
 #define SMARTCALCV2_DEPOSITMODEL_H
 
-#include <vector>
+#include <cstddef>
+#include <string>
 
+#include "../date.h"
 #include "../financeException.h"
+#include "../money.h"
+#include "DepositOperations.h"
 
 namespace s21 {
 
 class DepositModel {
  public:
-  struct DepositOperation {
-    DepositOperation() noexcept : year(0), month(0), day(0), amount(0) {}
-    DepositOperation(int year, int month, int day, double amount) noexcept
-        : year(year), month(month), day(day), amount(amount) {}
-    // Год операции
-    int year;
-    // Месяц операции
-    int month;
-    // День операции
-    int day;
-    // Сумма операции. Отрицательная - снятие, Положительная - пополнение
-    double amount;
-  };
+  using DepositOperation = s21::DepositOperation;
 
   enum PayPeriodDepositType {
     Day,
@@ -33,6 +25,13 @@ class DepositModel {
     End,
   };
 
+  // Начисление процентов за дни без операций: по одному дню, как при
+  // посуточном расчете до последнего бита, или сразу за весь промежуток -
+  // произведением на количество дней и сложными процентами при ежедневной
+  // капитализации. Второе быстрее, а итог отличается от посуточного расчета
+  // только округлением до копеек
+  enum InterestAccrual { PerDay, PerSpan };
+
   // Минимальная сумма депозита
   const double minDepositSum = 0.01;
   // Максимальная сумма депозита
@@ -50,7 +49,7 @@ class DepositModel {
   // Максимальная процентная ставка налога
   const double maxDepositTax = 100.0;
   // Минимальный год в датах
-  const int minDepositYear = 1900;
+  const int minDepositYear = Date::minYear;
   // Максимальный год в датах
   const int maxDepositYear = 2100;
 
@@ -89,6 +88,10 @@ class DepositModel {
     _capitalization = newCapitalization;
     _isCalc = false;
   }
+  void setAccrual(InterestAccrual newAccrual) noexcept {
+    accrual = newAccrual;
+    _isCalc = false;
+  }
   void setStartDate(int year, int month, int day) noexcept {
     yearStart = year;
     monthStart = month;
@@ -97,11 +100,12 @@ class DepositModel {
   }
 
   void AddOperation(int year, int month, int day, double amount) {
-    operationsList.emplace_back(
-        year, month, day, amount);
+    operationsList.Add(DepositOperation(year, month, day, amount));
     _isCalc = false;
   }
 
+  std::size_t ImportOperations(const std::string& path);
+
   [[nodiscard]] double getSum() const noexcept { return _sum; }
   [[nodiscard]] int getMonths() const noexcept { return _months; }
   [[nodiscard]] double getInterest() const noexcept { return _interest; }
@@ -109,6 +113,7 @@ class DepositModel {
   [[nodiscard]] PayPeriodDepositType getPayPeriod() const noexcept { return payPeriod; }
 
   [[nodiscard]] bool getCapitalization() const noexcept { return _capitalization; }
+  [[nodiscard]] InterestAccrual getAccrual() const noexcept { return accrual; }
   [[nodiscard]] int getYearStart() const noexcept { return yearStart; }
   [[nodiscard]] int getMonthStart() const noexcept { return monthStart; }
   [[nodiscard]] int getDayStart() const noexcept { return dayStart; }
@@ -117,10 +122,21 @@ class DepositModel {
   [[nodiscard]] double getDepositAmount() const noexcept { return depositAmount; }
   [[nodiscard]] double getTaxAmount() const noexcept { return taxAmount; }
   [[nodiscard]] bool getIsCalc() const noexcept { return _isCalc; }
+  [[nodiscard]] const DepositOperations& getOperations() const noexcept {
+    return operationsList;
+  }
+  [[nodiscard]] const DepositOperations& getImportedOperations()
+      const noexcept {
+    return importedList;
+  }
 
   void CalculateDeposit();
   void ClearOperationsList() noexcept {
-    operationsList.clear();
+    operationsList.Clear();
+    _isCalc = false;
+  }
+  void ClearImportedOperations() noexcept {
+    importedList.Clear();
     _isCalc = false;
   }
 
@@ -134,7 +150,8 @@ class DepositModel {
   [[nodiscard]] bool CheckDate(int year, int month, int day) const noexcept;
   void CheckOperations() const;
   void CalculateHandle();
-  void OperationsHandle(int year, int month, int day, double& total_sum) const;
+  void AccrueInterest(int days, double dayRate, Money& totalSum,
+                      Money& monthPayment, double& monthSum) const;
 
   // Сумма депозита
   double _sum;
@@ -148,12 +165,17 @@ class DepositModel {
   PayPeriodDepositType payPeriod;
   // Капитализация процентов нв депозите
   bool _capitalization;
+  // Способ начисления процентов между операциями
+  InterestAccrual accrual;
   // Дата начала срока депозита
   int yearStart;
   int monthStart;
   int dayStart;
   // Информация о пополнениях и снятиях
-  std::vector<DepositOperation> operationsList;
+  DepositOperations operationsList;
+  // Пополнения и снятия, загруженные из файла. Хранятся отдельно, потому что
+  // операции из полей ввода добавляются заново перед каждым расчетом
+  DepositOperations importedList;
 
   // Результаты расчета
   // Флаг, посчитано ли значение модели
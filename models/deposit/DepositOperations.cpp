@@ -0,0 +1,68 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#include "DepositOperations.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace s21 {
+
+/**
+ * @brief Добавляет операцию после операций того же дня.
+ *
+ * @param operation Операция.
+ */
+void DepositOperations::Add(const DepositOperation& operation) {
+  operations.insert(std::upper_bound(operations.begin(), operations.end(),
+                                     operation, Less),
+                    operation);
+}
+
+/**
+ * @brief Добавляет операции одним вызовом.
+ *
+ * Новые операции сортируются и сливаются с уже добавленными за линейное
+ * время. Если все они не раньше последней операции хранилища, например при
+ * загрузке выписки, отсортированной по дате, слияние не требуется.
+ *
+ * @param newOperations Операции в любом порядке.
+ */
+void DepositOperations::Add(std::vector<DepositOperation> newOperations) {
+  std::stable_sort(newOperations.begin(), newOperations.end(), Less);
+
+  if (operations.empty()) {
+    operations = std::move(newOperations);
+    return;
+  }
+
+  std::size_t middle = operations.size();
+  operations.insert(operations.end(),
+                    std::make_move_iterator(newOperations.begin()),
+                    std::make_move_iterator(newOperations.end()));
+  auto first = operations.begin() + static_cast<std::ptrdiff_t>(middle);
+
+  if (first != operations.end() && Less(*first, *(first - 1))) {
+    std::inplace_merge(operations.begin(), first, operations.end(), Less);
+  }
+}
+
+/**
+ * @brief Находит операции с датами из отрезка [from, to].
+ *
+ * @param from Первый день отрезка.
+ * @param to Последний день отрезка.
+ * @return Начало и конец диапазона операций.
+ */
+std::pair<DepositOperations::Iterator, DepositOperations::Iterator>
+DepositOperations::Range(Date from, Date to) const {
+  DepositOperation first(from.Year(), from.Month(), from.Day(), 0);
+  DepositOperation last(to.Year(), to.Month(), to.Day(), 0);
+  auto begin =
+      std::lower_bound(operations.begin(), operations.end(), first, Less);
+  auto end = std::upper_bound(begin, operations.end(), last, Less);
+  return {begin, end};
+}
+
+}  // namespace s21
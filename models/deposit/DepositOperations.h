@@ -0,0 +1,73 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALCV2_DEPOSITOPERATIONS_H
+#define SMARTCALCV2_DEPOSITOPERATIONS_H
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "../date.h"
+
+namespace s21 {
+
+struct DepositOperation {
+  DepositOperation() noexcept : year(0), month(0), day(0), amount(0) {}
+  DepositOperation(int year, int month, int day, double amount) noexcept
+      : year(year), month(month), day(day), amount(amount) {}
+  // Год операции
+  int year;
+  // Месяц операции
+  int month;
+  // День операции
+  int day;
+  // Сумма операции. Отрицательная - снятие, Положительная - пополнение
+  double amount;
+};
+
+// Пополнения и снятия, упорядоченные по дате. Операции одного дня хранятся
+// в порядке добавления. Даты не проверяются, поэтому в хранилище можно
+// положить некорректную операцию и сообщить о ней при расчете
+class DepositOperations final {
+ public:
+  using Iterator = std::vector<DepositOperation>::const_iterator;
+
+  DepositOperations() = default;
+  DepositOperations(const DepositOperations& other) = delete;
+  DepositOperations(DepositOperations&& other) = delete;
+  DepositOperations& operator=(const DepositOperations& other) = delete;
+  DepositOperations& operator=(DepositOperations&& other) = delete;
+  ~DepositOperations() = default;
+
+  void Add(const DepositOperation& operation);
+  void Add(std::vector<DepositOperation> newOperations);
+  void Clear() noexcept { operations.clear(); }
+
+  [[nodiscard]] std::size_t Size() const noexcept { return operations.size(); }
+  [[nodiscard]] bool Empty() const noexcept { return operations.empty(); }
+  [[nodiscard]] Iterator begin() const noexcept { return operations.begin(); }
+  [[nodiscard]] Iterator end() const noexcept { return operations.end(); }
+
+  [[nodiscard]] std::pair<Iterator, Iterator> Range(Date from,
+                                                    Date to) const;
+
+ private:
+  // Дата записана числом ГГГГММДД, поэтому упорядочены и некорректные даты
+  [[nodiscard]] static int Key(int year, int month, int day) noexcept {
+    return year * 10000 + month * 100 + day;
+  }
+
+  [[nodiscard]] static bool Less(const DepositOperation& lhs,
+                                 const DepositOperation& rhs) noexcept {
+    return Key(lhs.year, lhs.month, lhs.day) <
+           Key(rhs.year, rhs.month, rhs.day);
+  }
+
+  std::vector<DepositOperation> operations;
+};
+
+}  // namespace s21
+
+#endif  // SMARTCALCV2_DEPOSITOPERATIONS_H
@@ -5,6 +5,7 @@
 #ifndef SMARTCALC_FINANCEEXCEPTION_H
 #define SMARTCALC_FINANCEEXCEPTION_H
 
+#include <cstddef>
 #include <stdexcept>
 
 namespace s21 {
@@ -33,6 +34,18 @@ class FinanceInterestException : public FinanceException {
   virtual ~FinanceInterestException() = default;
 };
 
+class FinancePaymentException : public FinanceException {
+ public:
+  explicit FinancePaymentException(const char* arg) : FinanceException(arg){};
+  virtual ~FinancePaymentException() = default;
+};
+
+class FinanceEventException : public FinanceException {
+ public:
+  explicit FinanceEventException(const char* arg) : FinanceException(arg){};
+  virtual ~FinanceEventException() = default;
+};
+
 class FinanceTaxException : public FinanceException {
  public:
   explicit FinanceTaxException(const char* arg) : FinanceException(arg){};
@@ -80,6 +93,28 @@ class FinanceOperationNoMoneyException : public FinanceException {
   virtual ~FinanceOperationNoMoneyException() = default;
 };
 
+// Денежная сумма не помещается в 64-битное число копеек
+class FinanceOverflowException : public FinanceException {
+ public:
+  explicit FinanceOverflowException(const char* arg)
+      : FinanceException(arg){};
+  virtual ~FinanceOverflowException() = default;
+};
+
+// Ошибка загрузки операций из файла. Номер строки 0 - файл не удалось
+// прочитать
+class FinanceImportException : public FinanceException {
+ public:
+  FinanceImportException(const char* arg, std::size_t line)
+      : FinanceException(arg), _line(line){};
+  virtual ~FinanceImportException() = default;
+
+  [[nodiscard]] std::size_t getLine() const noexcept { return _line; }
+
+ private:
+  std::size_t _line;
+};
+
 }  // namespace s21
 
 #endif  //SMARTCALC_FINANCEEXCEPTION_H
@@ -4,47 +4,93 @@
 
 #include "GraphModel.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <utility>
 
 #include "../../helpers/mathHelper.h"
+#include "../../helpers/parallelHelper.h"
+#include "../../helpers/rootHelper.h"
+#include "../../helpers/stringHelper.h"
 
 namespace s21 {
 /**
  * @brief Конструктор по умолчанию класса GraphModel.
  *
  * Инициализирует модель графика с параметрами по умолчанию:
- * - mathModel - указатель на новый объект MathModel;
+ * - expression - выражение графика, функции разделены символом ';';
+ * - program - программа, вычисляющая все функции графика;
  * - xBegin - начальное значение оси X (-100 по умолчанию);
  * - xEnd - конечное значение оси X (100 по умолчанию);
  * - yBegin - начальное значение оси Y (0 по умолчанию);
  * - yEnd - конечное значение оси Y (0 по умолчанию);
+ * - tBegin, tEnd - диапазон параметра кривых (от 0 до 2 пи по умолчанию);
  * - yScaleAuto - автоматическое масштабирование оси Y (true по умолчанию);
- * - _points - пустой вектор точек графика.
+ * - plotType - вид графика (графики функций по умолчанию);
+ * - derivativeOrder - порядок производных, которые выводятся вместе с
+ * графиками функций (0 по умолчанию - без производных);
+ * - markersEnabled - поиск корней, экстремумов и пересечений графиков
+ * функций (false по умолчанию);
+ * - cancelFlag - флаг отмены расчета (отсутствует по умолчанию);
+ * - registers, intervalRegisters, jetRegisters - буферы регистров для
+ * вычисления выражения в точке, на отрезке и вместе с производными;
+ * - _result - пустой результат расчета графика.
  */
 GraphModel::GraphModel()
-    : mathModel(new MathModel),
+    : expression(),
+      program(),
       xBegin(-10),
       xEnd(10),
       yBegin(0),
       yEnd(0),
+      tBegin(0),
+      tEnd(2 * M_PI),
       yScaleAuto(true),
-      _points({}) {}
+      plotType(Explicit),
+      derivativeOrder(0),
+      markersEnabled(false),
+      cancelFlag(nullptr),
+      registers(),
+      intervalRegisters(),
+      jetRegisters(),
+      _result() {}
+
 /**
- * @brief Деструктор класса GraphModel.
+ * @brief Копирует настройки расчета из другой модели графика.
+ *
+ * Копируются выражение, диапазоны осей и параметра кривых, режим
+ * масштабирования оси Y, вид графика, порядок производных и поиск особых
+ * точек.
+ * Используется для передачи независимой копии настроек в рабочий поток.
  *
- * Освобождает ресурсы, занимаемые моделью графика.
- * Удаляет объект MathModel, на который указывает mathModel.
+ * @param other Модель графика, из которой копируются настройки.
  */
-GraphModel::~GraphModel() { delete mathModel; }
+void GraphModel::CopySettings(const GraphModel& other) {
+  expression = other.expression;
+  xBegin = other.xBegin;
+  xEnd = other.xEnd;
+  yBegin = other.yBegin;
+  yEnd = other.yEnd;
+  tBegin = other.tBegin;
+  tEnd = other.tEnd;
+  yScaleAuto = other.yScaleAuto;
+  plotType = other.plotType;
+  derivativeOrder = other.derivativeOrder;
+  markersEnabled = other.markersEnabled;
+}
 
 /**
  * @brief Сбрасывает результаты модели графика.
  *
- * Очищает вектор точек `_points`, удаляя все сохраненные точки графика.
+ * Очищает результат `_result`, удаляя точки всех функций графика, сетку
+ * тепловой карты и особые точки.
  */
-void GraphModel::ResetModelResults() noexcept { _points.clear(); }
+void GraphModel::ResetModelResults() noexcept {
+  _result.curves.clear();
+  _result.grid = GraphGrid();
+  _result.markers.clear();
+}
 
 /**
  * @brief Нормализует диапазон значений по оси X.
@@ -70,12 +116,25 @@ void GraphModel::NormalizeYRange() noexcept {
   }
 }
 
+/**
+ * @brief Нормализует диапазон параметра кривых.
+ *
+ * Если начальное значение параметра (`tBegin`) больше конечного (`tEnd`),
+ * метод меняет их местами.
+ */
+void GraphModel::NormalizeTRange() noexcept {
+  if (tBegin > tEnd) {
+    std::swap(tBegin, tEnd);
+  }
+}
+
 /**
  * @brief Проверяет данные модели графика.
  *
  * @throw WrongXGraphException если диапазон значений по оси X некорректен.
  * @throw WrongYGraphException если диапазон значений по оси Y некорректен и
  * масштаб оси Y не автоматический.
+ * @throw WrongTGraphException если диапазон параметра кривых некорректен.
  */
 void GraphModel::CheckModelData() const {
   if (xBegin == xEnd || xBegin < _minX || xEnd > _maxX) {
@@ -85,35 +144,868 @@ void GraphModel::CheckModelData() const {
   if (!yScaleAuto && (yBegin < _minY || yEnd > _maxY)) {
     throw WrongYGraphException("X range error");
   }
+
+  if ((plotType == Parametric || plotType == Polar) &&
+      (tBegin == tEnd || tBegin < _minT || tEnd > _maxT)) {
+    throw WrongTGraphException("T range error");
+  }
+}
+
+/**
+ * @brief Компилирует функции графика в одну программу.
+ *
+ * Выражение делится на функции по символу `expressionDelimiter`, каждая
+ * разбирается отдельно, а общие подвыражения разных функций вычисляются
+ * программой один раз.
+ *
+ * @throw InputZeroLengthException если выражение не содержит ни одной
+ * функции.
+ * @throw InputIncorrectException если одна из функций некорректна, содержит
+ * параметры или переменные, которых нет у выбранного вида графика: y у
+ * графика функций y = f(x), x и y у кривых, зависящих от параметра t.
+ */
+void GraphModel::CompileExpression() {
+  program.Clear();
+
+  for (const std::string& function :
+       stringHelper::Split(expression, expressionDelimiter)) {
+    MathModel mathModel(function);
+    program.Append(mathModel.getProgram());
+  }
+
+  if (program.OutputsCount() == 0) {
+    throw InputZeroLengthException("The input is empty");
+  }
+
+  if (plotType == Parametric || plotType == Polar) {
+    std::string names = program.getParameterNames();
+
+    if (program.UsesX() || program.UsesY() ||
+        (!names.empty() && names != std::string(1, curveParameter))) {
+      throw InputIncorrectException("Parameter value is not set");
+    }
+  } else if (program.HasParameters() ||
+             (plotType == Explicit && program.UsesY())) {
+    throw InputIncorrectException("Parameter value is not set");
+  }
 }
 
 /**
  * @brief Вычисляет точки графика и обновляет диапазон значений по оси Y.
+ *
+ * Если задан порядок производных, после графиков функций в результат
+ * добавляются графики их производных: сначала первых производных всех
+ * функций, затем вторых. Если включен поиск особых точек, они ищутся по
+ * вычисленным точкам методом `FindMarkers()`.
+ *
+ * @param numPoints Количество точек на всем диапазоне по оси X.
  */
-void GraphModel::CalculateHandle() {
+void GraphModel::CalculateHandle(int numPoints) {
   double yMin = 0.0;
   double yMax = 0.0;
 
-  CalculatePoints(xBegin, xEnd, numPointsAll, yMin, yMax, numOfCalc);
+  CompileExpression();
+
+  std::size_t functions = program.OutputsCount();
+  int order = std::clamp(derivativeOrder, 0, maxDerivativeOrder);
+  _result.curves.assign(functions * (order + 1), GraphCurve());
+
+  for (std::size_t curve = 0; curve < _result.curves.size(); ++curve) {
+    _result.curves[curve].function = curve % functions;
+    _result.curves[curve].derivative = static_cast<int>(curve / functions);
+  }
+
+  CalculatePoints(xBegin, xEnd, numPoints, yMin, yMax);
   SetYRange(yMin, yMax);
+
+  if (markersEnabled && !IsCancelled()) {
+    FindMarkers();
+  }
+}
+
+/**
+ * @brief Находит корни, экстремумы и пересечения графиков функций.
+ *
+ * Точки графиков уже вычислены, поэтому отрезки-кандидаты находятся одним
+ * проходом по ним: смена знака функции дает корень, смена знака приращения
+ * - экстремум, смена знака разности двух функций - пересечение. Кандидаты
+ * уточняются параллельно методом Брента по скомпилированной программе,
+ * экстремумы - как корни производной, вычисленной автоматическим
+ * дифференцированием. Кандидаты берутся только внутри непрерывных участков,
+ * поэтому полюса и скачки за корни не принимаются.
+ */
+void GraphModel::FindMarkers() {
+  std::vector<MarkerCandidate> candidates;
+  std::vector<std::size_t> functions;
+
+  for (std::size_t curve = 0; curve < _result.curves.size(); ++curve) {
+    CloseSegment(_result.curves[curve]);
+
+    if (_result.curves[curve].derivative == 0) {
+      functions.push_back(curve);
+      CollectCurveCandidates(_result.curves[curve], candidates);
+    }
+  }
+
+  for (std::size_t i = 0; i < functions.size(); ++i) {
+    for (std::size_t j = i + 1; j < functions.size(); ++j) {
+      CollectIntersections(_result.curves[functions[i]],
+                           _result.curves[functions[j]], candidates);
+    }
+  }
+
+  std::vector<GraphMarker> markers(candidates.size());
+  std::vector<char> found(candidates.size(), 0);
+
+  parallelHelper::ParallelFor(
+      candidates.size(), markerBlockSize,
+      [&](std::size_t begin, std::size_t end) {
+        std::vector<double> markerRegisters;
+        std::vector<Jet> markerJetRegisters;
+
+        for (std::size_t i = begin; i < end && !IsCancelled(); ++i) {
+          found[i] = RefineMarker(candidates[i], markerRegisters,
+                                  markerJetRegisters, markers[i]);
+        }
+      });
+
+  for (std::size_t i = 0; i < markers.size(); ++i) {
+    if (found[i]) {
+      _result.markers.push_back(markers[i]);
+    }
+  }
+}
+
+/**
+ * @brief Находит кандидатов в корни и экстремумы функции по ее точкам.
+ *
+ * @param curve Точки графика функции.
+ * @param candidates Вектор, в который добавляются кандидаты.
+ */
+void GraphModel::CollectCurveCandidates(
+    const GraphCurve& curve, std::vector<MarkerCandidate>& candidates) {
+  const std::vector<double>& xs = curve.xs;
+  const std::vector<double>& ys = curve.ys;
+
+  for (std::size_t segment = 0; segment < curve.SegmentsCount(); ++segment) {
+    std::size_t begin = curve.bounds[segment];
+    std::size_t end = curve.bounds[segment + 1];
+    // Знак последнего ненулевого приращения и начало его шага
+    int lastSlope = 0;
+    double lastSlopeX = 0;
+
+    for (std::size_t i = begin; i < end; ++i) {
+      if (ys[i] == 0) {
+        candidates.push_back(
+            {GraphMarker::Root, curve.function, curve.function, xs[i], xs[i]});
+      }
+
+      if (i + 1 == end) {
+        break;
+      }
+
+      if (ys[i] != 0 && ys[i + 1] != 0 && (ys[i] < 0) != (ys[i + 1] < 0)) {
+        candidates.push_back({GraphMarker::Root, curve.function,
+                              curve.function, xs[i], xs[i + 1]});
+      }
+
+      int slope = (ys[i + 1] > ys[i]) - (ys[i + 1] < ys[i]);
+
+      if (slope == 0) {
+        continue;
+      }
+
+      if (lastSlope != 0 && slope != lastSlope) {
+        candidates.push_back(
+            {lastSlope < 0 ? GraphMarker::Minimum : GraphMarker::Maximum,
+             curve.function, curve.function, lastSlopeX, xs[i + 1]});
+      }
+
+      lastSlope = slope;
+      lastSlopeX = xs[i];
+    }
+  }
+}
+
+/**
+ * @brief Находит кандидатов в пересечения двух графиков по их точкам.
+ *
+ * Точки равномерной сетки по оси X у всех функций совпадают, поэтому
+ * графики проходятся одновременно, а разность функций сравнивается в общих
+ * точках. Отрезок между общими точками принимается, только если на нем нет
+ * разрыва ни одной из функций.
+ *
+ * @param first Точки графика первой функции.
+ * @param second Точки графика второй функции.
+ * @param candidates Вектор, в который добавляются кандидаты.
+ */
+void GraphModel::CollectIntersections(
+    const GraphCurve& first, const GraphCurve& second,
+    std::vector<MarkerCandidate>& candidates) {
+  std::size_t i = 0;
+  std::size_t j = 0;
+  std::size_t firstSegment = 0;
+  std::size_t secondSegment = 0;
+  bool hasLast = false;
+  double lastX = 0;
+  double lastDifference = 0;
+  std::size_t lastFirstSegment = 0;
+  std::size_t lastSecondSegment = 0;
+
+  while (i < first.xs.size() && j < second.xs.size()) {
+    if (first.xs[i] < second.xs[j]) {
+      ++i;
+      continue;
+    }
+
+    if (second.xs[j] < first.xs[i]) {
+      ++j;
+      continue;
+    }
+
+    while (first.bounds[firstSegment + 1] <= i) {
+      ++firstSegment;
+    }
+
+    while (second.bounds[secondSegment + 1] <= j) {
+      ++secondSegment;
+    }
+
+    double x = first.xs[i];
+    double difference = first.ys[i] - second.ys[j];
+
+    if (difference == 0) {
+      candidates.push_back(
+          {GraphMarker::Intersection, first.function, second.function, x, x});
+    } else if (hasLast && lastDifference != 0 &&
+               (lastDifference < 0) != (difference < 0) &&
+               lastFirstSegment == firstSegment &&
+               lastSecondSegment == secondSegment) {
+      candidates.push_back({GraphMarker::Intersection, first.function,
+                            second.function, lastX, x});
+    }
+
+    hasLast = true;
+    lastX = x;
+    lastDifference = difference;
+    lastFirstSegment = firstSegment;
+    lastSecondSegment = secondSegment;
+    ++i;
+    ++j;
+  }
 }
 
 /**
- * @brief Проверяет, является ли точка разрывом функции.
+ * @brief Уточняет особую точку на отрезке-кандидате методом Брента.
  *
- * @param last Предыдущая точка.
- * @param current Текущая точка.
- * @return true если текущая точка является разрывом функции, в противном случае
+ * Корень уточняется по значениям функции, пересечение - по разности двух
+ * функций, экстремум - по первой производной. Вид экстремума определяется
+ * по смене знака производной.
+ *
+ * @param candidate Отрезок-кандидат.
+ * @param markerRegisters Буфер регистров для вычисления в точке.
+ * @param markerJetRegisters Буфер регистров для вычисления с производными.
+ * @param marker Найденная особая точка.
+ * @return true если точка найдена, false если на концах отрезка нет смены
+ * знака или функция в точке не определена.
+ */
+bool GraphModel::RefineMarker(const MarkerCandidate& candidate,
+                              std::vector<double>& markerRegisters,
+                              std::vector<Jet>& markerJetRegisters,
+                              GraphMarker& marker) const {
+  auto value = [&](double x) {
+    program.Run(x, markerRegisters);
+    double y = program.Output(candidate.function, markerRegisters);
+
+    if (candidate.kind == GraphMarker::Intersection) {
+      y -= program.Output(candidate.other, markerRegisters);
+    }
+
+    return y;
+  };
+  auto slope = [&](double x) {
+    program.Run(Jet::Variable(x), markerJetRegisters);
+    return program.Output(candidate.function, markerJetRegisters).d1;
+  };
+  bool isExtremum = candidate.kind == GraphMarker::Minimum ||
+                    candidate.kind == GraphMarker::Maximum;
+
+  double xLeft = candidate.xLeft;
+  double xRight = candidate.xRight;
+  double fLeft = isExtremum ? slope(xLeft) : value(xLeft);
+  double fRight = isExtremum ? slope(xRight) : value(xRight);
+
+  if (std::isnan(fLeft) || std::isnan(fRight) ||
+      (fLeft != 0 && fRight != 0 && (fLeft < 0) == (fRight < 0))) {
+    return false;
+  }
+
+  double tolerance = (xEnd - xBegin) * markerTolerance;
+  double x = isExtremum ? rootHelper::BrentRoot(slope, xLeft, xRight, fLeft,
+                                                fRight, tolerance)
+                        : rootHelper::BrentRoot(value, xLeft, xRight, fLeft,
+                                                fRight, tolerance);
+
+  program.Run(x, markerRegisters);
+  double y = program.Output(candidate.function, markerRegisters);
+
+  if (std::isnan(x) || std::isnan(y) || std::isinf(y)) {
+    return false;
+  }
+
+  marker.kind = candidate.kind;
+
+  if (isExtremum) {
+    marker.kind = fLeft < 0 || fRight > 0 ? GraphMarker::Minimum
+                                           : GraphMarker::Maximum;
+  }
+
+  marker.x = x;
+  marker.y = y;
+  marker.function = candidate.function;
+  marker.other = candidate.other;
+  return true;
+}
+
+/**
+ * @brief Вычисляет сетку значений тепловой карты.
+ *
+ * Тепловая карта строится по одной функции. Если масштаб оси Y
+ * автоматический, диапазон оси Y совпадает с диапазоном оси X.
+ *
+ * @param resolution Количество узлов сетки по каждой оси.
+ * @throw InputIncorrectException если выражение содержит несколько функций.
+ */
+void GraphModel::CalculateGridHandle(std::size_t resolution) {
+  CompileExpression();
+
+  if (program.OutputsCount() > 1) {
+    throw InputIncorrectException("Heatmap of several functions");
+  }
+
+  if (yScaleAuto) {
+    yBegin = xBegin;
+    yEnd = xEnd;
+  }
+
+  CalculateGrid(resolution);
+}
+
+/**
+ * @brief Вычисляет значения функции во всех узлах сетки.
+ *
+ * Сетка делится на квадратные блоки по `gridTileSize` узлов на сторону,
+ * блоки вычисляются параллельно на всех ядрах. Блок целиком помещается в
+ * кэш, а у каждого блока свой буфер регистров программы. Флаг отмены
+ * проверяется перед каждым блоком.
+ *
+ * @param resolution Количество узлов сетки по каждой оси.
+ */
+void GraphModel::CalculateGrid(std::size_t resolution) {
+  GraphGrid& grid = _result.grid;
+  grid.columns = resolution;
+  grid.rows = resolution;
+  grid.values.assign(resolution * resolution,
+                     std::numeric_limits<double>::quiet_NaN());
+
+  std::size_t tilesPerRow = (resolution + gridTileSize - 1) / gridTileSize;
+
+  parallelHelper::ParallelFor(
+      tilesPerRow * tilesPerRow, 1, [&](std::size_t begin, std::size_t end) {
+        std::vector<double> tileRegisters;
+
+        for (std::size_t tile = begin; tile < end && !IsCancelled(); ++tile) {
+          std::size_t rowBegin = tile / tilesPerRow * gridTileSize;
+          std::size_t columnBegin = tile % tilesPerRow * gridTileSize;
+          std::size_t rowEnd = std::min(rowBegin + gridTileSize, resolution);
+          std::size_t columnEnd =
+              std::min(columnBegin + gridTileSize, resolution);
+
+          for (std::size_t row = rowBegin; row < rowEnd; ++row) {
+            double y = GridNode(yBegin, yEnd, row, resolution);
+
+            for (std::size_t column = columnBegin; column < columnEnd;
+                 ++column) {
+              double x = GridNode(xBegin, xEnd, column, resolution);
+              program.Run(x, y, ExpressionProgram::NoParameters(),
+                          tileRegisters);
+              double z = program.Output(0, tileRegisters);
+
+              if (!std::isinf(z)) {
+                grid.values[row * resolution + column] = z;
+              }
+            }
+          }
+        }
+      });
+
+  UpdateZRange(grid);
+}
+
+/**
+ * @brief Возвращает координату узла равномерной сетки.
+ *
+ * @param begin Начало диапазона, координата первого узла.
+ * @param end Конец диапазона, координата последнего узла.
+ * @param index Номер узла от 0 до count - 1.
+ * @param count Количество узлов.
+ * @return Координата узла.
+ * @note Этот метод не выбрасывает исключений (noexcept).
+ */
+double GraphModel::GridNode(double begin, double end, std::size_t index,
+                            std::size_t count) noexcept {
+  if (count <= 1) {
+    return begin;
+  }
+
+  return begin + (end - begin) * static_cast<double>(index) /
+                     static_cast<double>(count - 1);
+}
+
+/**
+ * @brief Находит диапазон конечных значений функции на сетке.
+ *
+ * Если конечных значений нет, диапазон равен [0, 0].
+ *
+ * @param grid Сетка значений тепловой карты.
+ * @note Этот метод не выбрасывает исключений (noexcept).
+ */
+void GraphModel::UpdateZRange(GraphGrid& grid) noexcept {
+  bool first = true;
+
+  for (double z : grid.values) {
+    if (std::isnan(z)) {
+      continue;
+    }
+
+    if (first || z < grid.zMin) {
+      grid.zMin = z;
+    }
+
+    if (first || z > grid.zMax) {
+      grid.zMax = z;
+    }
+
+    first = false;
+  }
+}
+
+/**
+ * @brief Вычисляет параметрические или полярные кривые.
+ *
+ * Параметрическая кривая задается парой функций x(t); y(t), полярная -
+ * одной функцией r(t). Все функции вычисляются одной программой, поэтому
+ * обе координаты точки получаются за один проход. Сначала кривые
+ * вычисляются параллельно на равномерной сетке по t, затем шаги сетки,
+ * на которых соседние точки далеко друг от друга на экране, делятся
+ * методом `RefineArc()`. Если масштаб оси Y автоматический, диапазон оси Y
+ * подбирается по точкам кривых.
+ *
+ * @param numPoints Количество шагов равномерной сетки по t.
+ * @throw InputIncorrectException если у параметрической кривой нечетное
+ * количество функций.
+ */
+void GraphModel::CalculateCurvesHandle(std::size_t numPoints) {
+  CompileExpression();
+
+  std::size_t outputs = program.OutputsCount();
+
+  if (plotType == Parametric && outputs % 2 != 0) {
+    throw InputIncorrectException("Parametric curve needs x(t) and y(t)");
+  }
+
+  std::size_t curves = plotType == Parametric ? outputs / 2 : outputs;
+  std::size_t nodes = numPoints + 1;
+  std::vector<double> ts(nodes);
+  std::vector<double> xs(curves * nodes);
+  std::vector<double> ys(curves * nodes);
+
+  for (std::size_t i = 0; i < nodes; ++i) {
+    ts[i] = GridNode(tBegin, tEnd, i, nodes);
+  }
+
+  parallelHelper::ParallelFor(
+      nodes, curveBlockSize, [&](std::size_t begin, std::size_t end) {
+        std::vector<double> curveRegisters;
+
+        for (std::size_t i = begin; i < end && !IsCancelled(); ++i) {
+          RunCurve(ts[i], curveRegisters);
+
+          for (std::size_t curve = 0; curve < curves; ++curve) {
+            CurvePoint(curve, ts[i], curveRegisters, xs[curve * nodes + i],
+                       ys[curve * nodes + i]);
+          }
+        }
+      });
+
+  double yMin = 0.0;
+  double yMax = 0.0;
+
+  for (double y : ys) {
+    UpdateYRange(y, yMin, yMax);
+  }
+
+  double xScale = xEnd - xBegin;
+  double yScale = yScaleAuto ? yMax - yMin : yEnd - yBegin;
+
+  if (yScale <= 0) {
+    yScale = xScale;
+  }
+
+  // Шаги сетки делятся параллельно блоками, точки каждого блока затем
+  // добавляются в кривую по порядку
+  std::size_t blocks = (numPoints + curveBlockSize - 1) / curveBlockSize;
+  std::vector<std::vector<double>> blockXs(curves * blocks);
+  std::vector<std::vector<double>> blockYs(curves * blocks);
+
+  parallelHelper::ParallelFor(
+      numPoints, curveBlockSize, [&](std::size_t begin, std::size_t end) {
+        std::vector<double> curveRegisters;
+        std::size_t block = begin / curveBlockSize;
+
+        for (std::size_t curve = 0; curve < curves && !IsCancelled();
+             ++curve) {
+          std::vector<double>& outXs = blockXs[curve * blocks + block];
+          std::vector<double>& outYs = blockYs[curve * blocks + block];
+
+          for (std::size_t i = begin; i < end; ++i) {
+            std::size_t left = curve * nodes + i;
+            RefineArc(curve, ts[i], xs[left], ys[left], ts[i + 1],
+                      xs[left + 1], ys[left + 1], xScale, yScale, 0,
+                      curveRegisters, outXs, outYs);
+            outXs.push_back(xs[left + 1]);
+            outYs.push_back(ys[left + 1]);
+          }
+        }
+      });
+
+  _result.curves.assign(curves, GraphCurve());
+
+  for (std::size_t curve = 0; curve < curves; ++curve) {
+    GraphCurve& result = _result.curves[curve];
+    result.function = curve;
+    AddPoint(result, xs[curve * nodes], ys[curve * nodes]);
+
+    for (std::size_t block = 0; block < blocks; ++block) {
+      const std::vector<double>& pointXs = blockXs[curve * blocks + block];
+      const std::vector<double>& pointYs = blockYs[curve * blocks + block];
+
+      for (std::size_t i = 0; i < pointXs.size(); ++i) {
+        AddPoint(result, pointXs[i], pointYs[i]);
+        UpdateYRange(pointYs[i], yMin, yMax);
+      }
+    }
+  }
+
+  SetYRange(yMin, yMax);
+}
+
+/**
+ * @brief Вычисляет программу кривых для значения параметра t.
+ *
+ * @param t Значение параметра.
+ * @param curveRegisters Буфер регистров.
+ */
+void GraphModel::RunCurve(double t, std::vector<double>& curveRegisters) const {
+  ExpressionProgram::Parameters parameters = ExpressionProgram::NoParameters();
+  parameters[curveParameter - 'a'] = t;
+  program.Run(std::numeric_limits<double>::quiet_NaN(), parameters,
+              curveRegisters);
+}
+
+/**
+ * @brief Возвращает точку кривой по вычисленным регистрам программы.
+ *
+ * Для параметрической кривой координаты - значения функций 2k и 2k + 1,
+ * для полярной - r(t) cos t и r(t) sin t.
+ *
+ * @param curve Номер кривой.
+ * @param t Значение параметра.
+ * @param curveRegisters Регистры программы, вычисленные методом
+ * `RunCurve()`.
+ * @param x Абсцисса точки, бесконечность заменяется на NaN.
+ * @param y Ордината точки, бесконечность заменяется на NaN.
+ */
+void GraphModel::CurvePoint(std::size_t curve, double t,
+                            const std::vector<double>& curveRegisters,
+                            double& x, double& y) const {
+  if (plotType == Parametric) {
+    x = program.Output(2 * curve, curveRegisters);
+    y = program.Output(2 * curve + 1, curveRegisters);
+  } else {
+    double r = program.Output(curve, curveRegisters);
+    x = r * std::cos(t);
+    y = r * std::sin(t);
+  }
+
+  if (std::isinf(x) || std::isinf(y)) {
+    x = std::numeric_limits<double>::quiet_NaN();
+    y = std::numeric_limits<double>::quiet_NaN();
+  }
+}
+
+/**
+ * @brief Делит шаг сетки по t, пока соседние точки кривой далеко друг от
+ * друга на экране.
+ *
+ * Расстояние между точками считается в долях диапазонов осей, то есть
+ * пропорционально расстоянию в пикселях. Шаг делится пополам, пока оно
+ * больше `arcTolerance`, поэтому точек больше там, где кривая быстро
+ * движется или резко поворачивает. Если на глубине `arcMaxDepth` точки все
+ * еще далеко, на шаге есть разрыв и между ними добавляется NaN. Если кривая
+ * определена только на одном конце шага, деление находит границу области
+ * определения.
+ *
+ * @param curve Номер кривой.
+ * @param t0 Параметр левой точки, она уже добавлена.
+ * @param x0 Абсцисса левой точки.
+ * @param y0 Ордината левой точки.
+ * @param t1 Параметр правой точки, ее добавляет вызывающий.
+ * @param x1 Абсцисса правой точки.
+ * @param y1 Ордината правой точки.
+ * @param xScale Диапазон оси X.
+ * @param yScale Диапазон оси Y.
+ * @param depth Глубина деления.
+ * @param curveRegisters Буфер регистров.
+ * @param xs Столбец, в который добавляются абсциссы точек деления.
+ * @param ys Столбец, в который добавляются ординаты точек деления.
+ */
+void GraphModel::RefineArc(std::size_t curve, double t0, double x0, double y0,
+                           double t1, double x1, double y1, double xScale,
+                           double yScale, int depth,
+                           std::vector<double>& curveRegisters,
+                           std::vector<double>& xs,
+                           std::vector<double>& ys) const {
+  bool defined0 = !std::isnan(x0) && !std::isnan(y0);
+  bool defined1 = !std::isnan(x1) && !std::isnan(y1);
+
+  if (!defined0 && !defined1) {
+    return;
+  }
+
+  if (defined0 && defined1 &&
+      std::hypot((x1 - x0) / xScale, (y1 - y0) / yScale) <= arcTolerance) {
+    return;
+  }
+
+  if (depth == arcMaxDepth) {
+    if (defined0 && defined1) {
+      xs.push_back(std::numeric_limits<double>::quiet_NaN());
+      ys.push_back(std::numeric_limits<double>::quiet_NaN());
+    }
+
+    return;
+  }
+
+  double tMiddle = t0 + (t1 - t0) / 2;
+  double xMiddle;
+  double yMiddle;
+  RunCurve(tMiddle, curveRegisters);
+  CurvePoint(curve, tMiddle, curveRegisters, xMiddle, yMiddle);
+
+  RefineArc(curve, t0, x0, y0, tMiddle, xMiddle, yMiddle, xScale, yScale,
+            depth + 1, curveRegisters, xs, ys);
+  xs.push_back(xMiddle);
+  ys.push_back(yMiddle);
+  RefineArc(curve, tMiddle, xMiddle, yMiddle, t1, x1, y1, xScale, yScale,
+            depth + 1, curveRegisters, xs, ys);
+}
+
+/**
+ * @brief Вычисляет неявно заданные кривые f(x, y) = 0.
+ *
+ * Каждая функция выражения дает свою кривую. Если масштаб оси Y
+ * автоматический, диапазон оси Y совпадает с диапазоном оси X.
+ *
+ * @param depth Глубина деления ячеек начальной сетки.
+ */
+void GraphModel::CalculateImplicitHandle(std::size_t depth) {
+  CompileExpression();
+  _result.curves.assign(program.OutputsCount(), GraphCurve());
+
+  if (yScaleAuto) {
+    yBegin = xBegin;
+    yEnd = xEnd;
+  }
+
+  for (std::size_t curve = 0; curve < program.OutputsCount(); ++curve) {
+    _result.curves[curve].function = curve;
+    CalculateContour(curve, depth);
+  }
+}
+
+/**
+ * @brief Находит нулевую линию уровня одной функции.
+ *
+ * Ячейки начальной сетки `implicitBaseCells` x `implicitBaseCells`
+ * обрабатываются параллельно, каждая делится методом `RefineCell()`. Делятся
+ * только ячейки, через которые может проходить кривая, поэтому объем
+ * вычислений пропорционален длине кривой, а не площади графика. Найденные
+ * отрезки собираются в ломаные.
+ *
+ * @param curve Номер функции графика.
+ * @param depth Глубина деления ячеек начальной сетки.
+ */
+void GraphModel::CalculateContour(std::size_t curve, std::size_t depth) {
+  std::size_t cellSize = std::size_t{1} << depth;
+  std::size_t cells = implicitBaseCells * cellSize;
+  std::vector<std::vector<contourHelper::Segment>> tileSegments(
+      implicitBaseCells * implicitBaseCells);
+
+  parallelHelper::ParallelFor(
+      tileSegments.size(), 1, [&](std::size_t begin, std::size_t end) {
+        std::vector<double> cellRegisters;
+        std::vector<Interval> cellIntervalRegisters;
+
+        for (std::size_t tile = begin; tile < end && !IsCancelled(); ++tile) {
+          RefineCell(curve, tile % implicitBaseCells * cellSize,
+                     tile / implicitBaseCells * cellSize, cellSize, cells,
+                     cellRegisters, cellIntervalRegisters, tileSegments[tile]);
+        }
+      });
+
+  std::vector<contourHelper::Segment> segments;
+
+  for (const auto& tile : tileSegments) {
+    segments.insert(segments.end(), tile.begin(), tile.end());
+  }
+
+  GraphCurve& result = _result.curves[curve];
+  contourHelper::ChainSegments(segments, result.xs, result.ys, result.bounds);
+}
+
+/**
+ * @brief Делит ячейку сетки, через которую может проходить кривая.
+ *
+ * Функция оценивается на ячейке интервальной арифметикой. Если оценка не
+ * содержит нуля, кривая через ячейку не проходит и ячейка отбрасывается.
+ * Иначе ячейка делится на четыре, а в ячейках самой мелкой сетки отрезки
+ * кривой находятся методом marching squares. Ячейки, в которых функция
+ * терпит разрыв, пропускаются: смена знака на полюсе или скачке не является
+ * нулем функции.
+ *
+ * @param curve Номер функции графика.
+ * @param column Номер левого нижнего узла ячейки на самой мелкой сетке.
+ * @param row Номер левого нижнего узла ячейки на самой мелкой сетке.
+ * @param size Размер ячейки в ячейках самой мелкой сетки.
+ * @param cells Количество ячеек самой мелкой сетки по каждой оси.
+ * @param cellRegisters Буфер регистров для вычисления функции в точке.
+ * @param cellIntervalRegisters Буфер регистров для интервальной оценки.
+ * @param segments Вектор, в который добавляются найденные отрезки.
+ */
+void GraphModel::RefineCell(
+    std::size_t curve, std::size_t column, std::size_t row, std::size_t size,
+    std::size_t cells, std::vector<double>& cellRegisters,
+    std::vector<Interval>& cellIntervalRegisters,
+    std::vector<contourHelper::Segment>& segments) const {
+  contourHelper::Cell cell;
+  cell.column = column;
+  cell.row = row;
+  cell.xLeft = GridNode(xBegin, xEnd, column, cells + 1);
+  cell.xRight = GridNode(xBegin, xEnd, column + size, cells + 1);
+  cell.yBottom = GridNode(yBegin, yEnd, row, cells + 1);
+  cell.yTop = GridNode(yBegin, yEnd, row + size, cells + 1);
+
+  program.Run(Interval(cell.xLeft, cell.xRight),
+              Interval(cell.yBottom, cell.yTop),
+              ExpressionProgram::NoParameters(), cellIntervalRegisters);
+  Interval z = program.Output(curve, cellIntervalRegisters);
+
+  if (z.IsEmpty() || !z.Contains(0)) {
+    return;
+  }
+
+  if (size > 1) {
+    std::size_t half = size / 2;
+
+    for (std::size_t child = 0; child < 4; ++child) {
+      RefineCell(curve, column + (child % 2) * half, row + (child / 2) * half,
+                 half, cells, cellRegisters, cellIntervalRegisters, segments);
+    }
+
+    return;
+  }
+
+  if (!z.continuous) {
+    return;
+  }
+
+  const double xs[4] = {cell.xLeft, cell.xRight, cell.xRight, cell.xLeft};
+  const double ys[4] = {cell.yBottom, cell.yBottom, cell.yTop, cell.yTop};
+
+  for (int corner = 0; corner < 4; ++corner) {
+    program.Run(xs[corner], ys[corner], ExpressionProgram::NoParameters(),
+                cellRegisters);
+    cell.values[corner] = program.Output(curve, cellRegisters);
+  }
+
+  contourHelper::MarchSquare(cell, cells, segments);
+}
+
+/**
+ * @brief Проверяет, запрошена ли отмена расчета.
+ *
+ * @return true если флаг отмены установлен, в противном случае - false.
+ * @note Этот метод не выбрасывает исключений (noexcept).
+ */
+bool GraphModel::IsCancelled() const noexcept {
+  return cancelFlag != nullptr && cancelFlag->load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Вычисляет значение функции графика в точке.
+ *
+ * @param curve Номер функции графика.
+ * @param x Абсцисса точки.
+ * @return Значение функции, бесконечность заменяется на NaN.
+ */
+double GraphModel::CalcY(std::size_t curve, double x) {
+  program.Run(x, registers);
+  return Finite(program.Output(curve, registers));
+}
+
+/**
+ * @brief Заменяет бесконечное значение на NaN: на графике оно не
+ * отображается.
+ *
+ * @param y Значение функции.
+ * @return Значение функции или NaN.
+ * @note Этот метод не выбрасывает исключений (noexcept).
+ */
+double GraphModel::Finite(double y) noexcept {
+  return std::isinf(y) ? std::numeric_limits<double>::quiet_NaN() : y;
+}
+
+/**
+ * @brief Проверяет, есть ли между двумя соседними точками разрыв функции.
+ *
+ * @param curve Номер функции графика.
+ * @param xLast Абсцисса предыдущей точки.
+ * @param xCurrent Абсцисса текущей точки.
+ * @return true если непрерывность на отрезке не доказана, в противном случае
+ * - false.
+ */
+bool GraphModel::IsFunctionBreakPoint(std::size_t curve, double xLast,
+                                      double xCurrent) {
+  program.Run(Interval(xLast, xCurrent), intervalRegisters);
+  return IsFunctionBreak(program.Output(curve, intervalRegisters));
+}
+
+/**
+ * @brief Проверяет по интервальной оценке функции, есть ли на отрезке разрыв.
+ *
+ * Если оценка подтверждает, что функция на отрезке определена и непрерывна,
+ * точки на концах отрезка можно соединить линией. Иначе на отрезке есть
+ * полюс, скачок или граница области определения. Если функция не определена
+ * нигде на отрезке, соединять нечего и разрывом это не считается.
+ *
+ * @param y Интервальная оценка функции на отрезке.
+ * @return true если непрерывность на отрезке не доказана, в противном случае
  * - false.
  * @note Этот метод не выбрасывает исключений (noexcept).
  */
-bool GraphModel::IsFunctionBreakPoint(double last,
-                                      double current) noexcept {
-  return (std::isnan(last) && !std::isnan(current)) ||
-         (std::isnan(current) && !std::isnan(last)) ||
-         ((last < 0 && current > 0) || (last > 0 && current < 0)) &&
-             (std::abs(last - current) > 40) ||
-         (!std::isinf(last / current) && std::abs(last / current) > 1E20);
+bool GraphModel::IsFunctionBreak(const Interval& y) noexcept {
+  return !y.IsEmpty() && !y.continuous;
 }
 
 /**
@@ -160,7 +1052,9 @@ void GraphModel::SetYRange(double yMin, double yMax) noexcept {
  *
  * Метод вычисляет точки графика для заданного диапазона значений по оси X.
  * Количество вычисленных точек определяется параметром `numPoints`.
- * Результаты вычислений сохраняются в векторе `_points`.
+ * Результаты вычислений сохраняются в столбцах результата `_result`.
+ * Если между соседними точками непрерывность функции не доказана, разрыв
+ * локализуется методом `LocateBreak()`.
  *
  * @param _xBegin Начальное значение диапазона по оси X.
  * @param _xEnd Конечное значение диапазона по оси X.
@@ -170,22 +1064,33 @@ void GraphModel::SetYRange(double yMin, double yMax) noexcept {
  * значение по оси Y.
  * @param yMax Ссылка на переменную, в которую будет сохранено максимальное
  * значение по оси Y.
- * @param numOfCalcPoints Количество дополнительных вычислений точек, если
- * обнаружен разрыв функции.
  * @note Метод корректирует значения координат для обеспечения точности
  * вычислений.
+ * @note Флаг отмены проверяется каждые `cancelCheckStep` точек, при отмене
+ * метод завершается, оставляя уже вычисленные точки.
  */
 void GraphModel::CalculatePoints(double _xBegin, double _xEnd, double numPoints,
-                                 double& yMin, double& yMax,
-                                 int numOfCalcPoints) {
+                                 double& yMin, double& yMax) {
   double step = (_xEnd - _xBegin) / numPoints;
+  double tolerance = (_xEnd - _xBegin) * breakTolerance;
   int points = static_cast<int>(numPoints);
+  std::size_t functions = program.OutputsCount();
+  std::size_t curves = _result.curves.size();
+  bool withDerivatives = curves > functions;
+  std::vector<double> yValues(curves);
+  std::vector<bool> breaks(functions);
 
   bool firstIteration = true;
-  double yLastVal = 0.0;
   double xLastVal = 0.0;
 
-  for (double xValueTemp = _xBegin; points >= 0; xValueTemp += step) {
+  for (int i = 0; i <= points; ++i) {
+    if (i % cancelCheckStep == 0 && IsCancelled()) {
+      return;
+    }
+
+    // Абсцисса считается от начала отрезка, а не накоплением шага, чтобы
+    // последняя точка точно совпала с его концом
+    double xValueTemp = i == points ? _xEnd : _xBegin + step * i;
     double xValue;
 
     if (_xEnd - _xBegin > 1 || std::abs(xValueTemp) < (1E-7 / numPointsAll)) {
@@ -194,44 +1099,145 @@ void GraphModel::CalculatePoints(double _xBegin, double _xEnd, double numPoints,
       xValue = xValueTemp;
     }
 
-    mathModel->setX(xValue);
-    mathModel->Calculate();
+    // Все функции вычисляются одним проходом программы, значения и оценки
+    // на отрезке сохраняются до локализации разрывов, которая использует
+    // те же регистры. С производными программа вычисляется над Jet: значение
+    // функции совпадает с вычисленным над double
+    if (withDerivatives) {
+      program.Run(Jet::Variable(xValue), jetRegisters);
 
-    double yValue = mathModel->getResult();
-
-    if (std::isinf(yValue)) {
-      yValue = std::numeric_limits<double>::quiet_NaN();
-    }
+      for (std::size_t curve = 0; curve < curves; ++curve) {
+        const Jet& y = program.Output(curve % functions, jetRegisters);
+        int derivative = _result.curves[curve].derivative;
+        yValues[curve] =
+            Finite(derivative == 0 ? y.value : derivative == 1 ? y.d1 : y.d2);
+      }
+    } else {
+      program.Run(xValue, registers);
 
-    if (!firstIteration && IsFunctionBreakPoint(yLastVal, yValue)) {
-      if (numOfCalcPoints > 0) {
-        CalculatePoints(xLastVal, xValue, numPointsPre, yMin, yMax,
-                        numOfCalcPoints - 1);
-      } else {
-        (*(--_points.end())).second = std::numeric_limits<double>::quiet_NaN();
+      for (std::size_t curve = 0; curve < curves; ++curve) {
+        yValues[curve] = Finite(program.Output(curve, registers));
       }
     }
 
-    _points.emplace_back(
-        xValue,
-        yValue);  // должно быть лучше points.push_back(std::make_pair(xValue,
-                  // yValue));, тк  не происходит двойное копирвание
-    --points;
+    if (!firstIteration) {
+      program.Run(Interval(xLastVal, xValue), intervalRegisters);
+    }
 
-    if (yValue < yMin && !std::isnan(yValue) && !std::isinf(yValue)) {
-      yMin = yValue;
+    for (std::size_t function = 0; function < functions; ++function) {
+      breaks[function] =
+          !firstIteration &&
+          IsFunctionBreak(program.Output(function, intervalRegisters));
     }
 
-    if (yValue > yMax && !std::isnan(yValue) && !std::isinf(yValue)) {
-      yMax = yValue;
+    for (std::size_t curve = 0; curve < curves; ++curve) {
+      // Разрыв локализуется по самой функции, графики производных на нем
+      // только прерываются
+      if (breaks[curve % functions]) {
+        if (curve < functions) {
+          LocateBreak(curve, xLastVal, xValue, tolerance, yMin, yMax);
+        } else {
+          CloseSegment(_result.curves[curve]);
+        }
+      }
+
+      AddPoint(_result.curves[curve], xValue, yValues[curve]);
+      UpdateYRange(yValues[curve], yMin, yMax);
     }
 
     firstIteration = false;
-    yLastVal = yValue;
     xLastVal = xValue;
   }
 }
 
+/**
+ * @brief Локализует разрывы функции между двумя точками делением пополам.
+ *
+ * Отрезок делится пополам, пока его длина больше `tolerance`. Половины, на
+ * которых непрерывность доказана интервальной оценкой или функция нигде не
+ * определена, дальше не делятся. Точки деления добавляются в результат по
+ * порядку, а на отрезке длиной не больше `tolerance` текущий участок
+ * закрывается. Поэтому края полюсов и границы области определения получаются
+ * с точностью `tolerance` за несколько вычислений на каждый разрыв.
+ *
+ * @param curve Номер функции графика.
+ * @param xLeft Левая граница отрезка, точка в ней уже добавлена.
+ * @param xRight Правая граница отрезка, точку в ней добавляет вызывающий.
+ * @param tolerance Точность локализации разрыва по оси X.
+ * @param yMin Ссылка на минимальное значение по оси Y.
+ * @param yMax Ссылка на максимальное значение по оси Y.
+ */
+void GraphModel::LocateBreak(std::size_t curve, double xLeft, double xRight,
+                             double tolerance, double& yMin, double& yMax) {
+  double xMiddle = xLeft + (xRight - xLeft) / 2;
+
+  if (xRight - xLeft <= tolerance || xMiddle <= xLeft || xMiddle >= xRight) {
+    CloseSegment(_result.curves[curve]);
+    return;
+  }
+
+  double yMiddle = CalcY(curve, xMiddle);
+
+  if (IsFunctionBreakPoint(curve, xLeft, xMiddle)) {
+    LocateBreak(curve, xLeft, xMiddle, tolerance, yMin, yMax);
+  }
+
+  AddPoint(_result.curves[curve], xMiddle, yMiddle);
+  UpdateYRange(yMiddle, yMin, yMax);
+
+  if (IsFunctionBreakPoint(curve, xMiddle, xRight)) {
+    LocateBreak(curve, xMiddle, xRight, tolerance, yMin, yMax);
+  }
+}
+
+/**
+ * @brief Расширяет диапазон значений по оси Y конечным значением функции.
+ *
+ * @param y Значение функции.
+ * @param yMin Ссылка на минимальное значение по оси Y.
+ * @param yMax Ссылка на максимальное значение по оси Y.
+ * @note Этот метод не выбрасывает исключений (noexcept).
+ */
+void GraphModel::UpdateYRange(double y, double& yMin, double& yMax) noexcept {
+  if (y < yMin && !std::isnan(y) && !std::isinf(y)) {
+    yMin = y;
+  }
+
+  if (y > yMax && !std::isnan(y) && !std::isinf(y)) {
+    yMax = y;
+  }
+}
+
+/**
+ * @brief Добавляет точку функции графика.
+ *
+ * Конечная точка дописывается в текущий участок, NaN закрывает его.
+ *
+ * @param curve Точки функции графика.
+ * @param x Абсцисса точки.
+ * @param y Ордината точки.
+ */
+void GraphModel::AddPoint(GraphCurve& curve, double x, double y) {
+  if (std::isnan(y) || std::isinf(y)) {
+    CloseSegment(curve);
+    return;
+  }
+
+  curve.xs.push_back(x);
+  curve.ys.push_back(y);
+}
+
+/**
+ * @brief Закрывает текущий участок функции графика, если в нем есть точки.
+ *
+ * @param curve Точки функции графика.
+ */
+void GraphModel::CloseSegment(GraphCurve& curve) {
+  if (curve.xs.size() > curve.bounds.back()) {
+    curve.bounds.push_back(curve.xs.size());
+  }
+}
+
 /**
  * @brief Вычисляет график.
  *
@@ -239,9 +1245,13 @@ void GraphModel::CalculatePoints(double _xBegin, double _xEnd, double numPoints,
  * для вычисления графика:
  * 1. Сброс результатов модели с помощью `ResetModelResults()`.
  * 2. Нормализация диапазона значений по оси X с помощью `NormalizeXRange()`.
- * 3. Нормализация диапазона значений по оси Y с помощью `NormalizeYRange()`.
+ * 3. Нормализация диапазонов значений по оси Y и параметра кривых с помощью
+ * `NormalizeYRange()` и `NormalizeTRange()`.
  * 4. Проверка корректности данных модели с помощью `CheckModelData()`.
- * 5. Вычисление точек графика с помощью `CalculateHandle()`.
+ * 5. Вычисление точек графика с помощью `CalculateHandle()`, сетки
+ * тепловой карты с помощью `CalculateGridHandle()`, неявных кривых с
+ * помощью `CalculateImplicitHandle()` или параметрических и полярных кривых
+ * с помощью `CalculateCurvesHandle()`.
  *
  * Последовательность этих шагов необходима для подготовки данных и корректного
  * расчета графика.
@@ -250,8 +1260,70 @@ void GraphModel::CalculateGraph() {
   ResetModelResults();
   NormalizeXRange();
   NormalizeYRange();
+  NormalizeTRange();
   CheckModelData();
-  CalculateHandle();
+
+  if (plotType == Heatmap) {
+    CalculateGridHandle(gridResolution);
+  } else if (plotType == Implicit) {
+    CalculateImplicitHandle(implicitDepth);
+  } else if (plotType == Parametric || plotType == Polar) {
+    CalculateCurvesHandle(numPointsCurve);
+  } else {
+    CalculateHandle(numPointsAll);
+  }
+}
+
+/**
+ * @brief Вычисляет грубый предварительный график.
+ *
+ * Выполняет те же шаги, что и `CalculateGraph()`, но по `numPointsPreview`
+ * точкам, на сетке из `gridResolutionPreview` узлов по каждой оси, с
+ * глубиной деления ячеек `implicitDepthPreview` или по
+ * `numPointsCurvePreview` шагам параметра кривых.
+ * Используется для быстрого показа графика, пока идет окончательный расчет.
+ */
+void GraphModel::CalculatePreview() {
+  ResetModelResults();
+  NormalizeXRange();
+  NormalizeYRange();
+  NormalizeTRange();
+  CheckModelData();
+
+  if (plotType == Heatmap) {
+    CalculateGridHandle(gridResolutionPreview);
+  } else if (plotType == Implicit) {
+    CalculateImplicitHandle(implicitDepthPreview);
+  } else if (plotType == Parametric || plotType == Polar) {
+    CalculateCurvesHandle(numPointsCurvePreview);
+  } else {
+    CalculateHandle(numPointsPreview);
+  }
+}
+
+/**
+ * @brief Забирает результат последнего расчета.
+ *
+ * Столбцы точек перемещаются в результат без копирования, после вызова
+ * результат модели пуст.
+ *
+ * @param isFinal Признак окончательного результата.
+ * @return Снимок результата расчета с диапазонами осей.
+ */
+GraphResult GraphModel::TakeResult(bool isFinal) {
+  for (GraphCurve& curve : _result.curves) {
+    CloseSegment(curve);
+  }
+
+  GraphResult result = std::move(_result);
+  result.xBegin = xBegin;
+  result.xEnd = xEnd;
+  result.yBegin = yBegin;
+  result.yEnd = yEnd;
+  result.isFinal = isFinal;
+  result.xOrdered = plotType == Explicit;
+  ResetModelResults();
+  return result;
 }
 
 }  // namespace s21
\ No newline at end of file
@@ -5,70 +5,198 @@
 #ifndef SMARTCALCV2_GRAPHMODEL_H
 #define SMARTCALCV2_GRAPHMODEL_H
 
+#include <atomic>
+#include <string>
 #include <vector>
 
+#include "../../helpers/contourHelper.h"
 #include "../calcException.h"
 #include "../math/mathModel.h"
+#include "GraphResult.h"
 
 namespace s21 {
 
 class GraphModel final {
  public:
+  // Explicit - графики функций y = f(x), Heatmap - тепловая карта f(x, y),
+  // Implicit - неявно заданные кривые f(x, y) = 0, Parametric - кривые
+  // x(t), y(t), Polar - кривые r(t) в полярных координатах
+  enum PlotType { Explicit, Heatmap, Implicit, Parametric, Polar };
+
   const double _minX = -1E6;
   const double _minY = -1E6;
   const double _maxX = 1E6;
   const double _maxY = 1E6;
+  const double _minT = -1E6;
+  const double _maxT = 1E6;
+  const int maxDerivativeOrder = 2;
 
   GraphModel();
   GraphModel(const GraphModel& other) = delete;
   GraphModel(GraphModel&& other) = delete;
   GraphModel& operator=(const GraphModel& other) = delete;
   GraphModel& operator=(GraphModel&& other) = delete;
-  ~GraphModel();
+  ~GraphModel() = default;
 
   void setXBegin(double newX) noexcept { xBegin = newX; }
   void setYBegin(double newY) noexcept { yBegin = newY; }
   void setXEnd(double newX) noexcept { xEnd = newX; }
   void setYEnd(double newY) noexcept { yEnd = newY; }
+  void setTBegin(double newT) noexcept { tBegin = newT; }
+  void setTEnd(double newT) noexcept { tEnd = newT; }
 
   void setGraphExpression(const std::string& newExpression) {
-    mathModel->setExpression(newExpression);
+    expression = newExpression;
   }
 
   void setYScaleAuto(bool flag) noexcept { yScaleAuto = flag; }
+  void setPlotType(PlotType type) noexcept { plotType = type; }
+  void setDerivativeOrder(int order) noexcept { derivativeOrder = order; }
+  void setMarkersEnabled(bool flag) noexcept { markersEnabled = flag; }
+  void setCancelFlag(const std::atomic<bool>* flag) noexcept {
+    cancelFlag = flag;
+  }
+  void CopySettings(const GraphModel& other);
 
   [[nodiscard]] double getXBegin() const noexcept { return xBegin; }
   [[nodiscard]] double getYBegin() const noexcept { return yBegin; }
   [[nodiscard]] double getXEnd() const noexcept { return xEnd; }
   [[nodiscard]] double getYEnd() const noexcept { return yEnd; }
+  [[nodiscard]] double getTBegin() const noexcept { return tBegin; }
+  [[nodiscard]] double getTEnd() const noexcept { return tEnd; }
   [[nodiscard]] bool getYScaleAuto() const noexcept { return yScaleAuto; }
-  const std::vector<std::pair<double, double>>& getPoints() { return _points; }
+  [[nodiscard]] PlotType getPlotType() const noexcept { return plotType; }
+  [[nodiscard]] int getDerivativeOrder() const noexcept {
+    return derivativeOrder;
+  }
+  [[nodiscard]] bool getMarkersEnabled() const noexcept {
+    return markersEnabled;
+  }
+  [[nodiscard]] std::string getGraphExpression() const { return expression; }
+  [[nodiscard]] const GraphResult& getResult() const noexcept {
+    return _result;
+  }
 
   void CalculateGraph();
+  void CalculatePreview();
+  [[nodiscard]] GraphResult TakeResult(bool isFinal);
 
  private:
+  // Отрезок, на котором по точкам графика найдена особая точка. Для корня
+  // на концах отрезка функция разного знака, для экстремума - производная,
+  // для пересечения - разность функций
+  struct MarkerCandidate {
+    GraphMarker::Kind kind = GraphMarker::Root;
+    std::size_t function = 0;
+    std::size_t other = 0;
+    double xLeft = 0;
+    double xRight = 0;
+  };
+
   const int numPointsAll = 2E4;
-  const int numPointsPre = 100;
-  const int numOfCalc = 3;
+  // Точность уточнения особых точек в долях диапазона по оси X
+  const double markerTolerance = 1E-14;
+  const std::size_t markerBlockSize = 64;
+  // Точность локализации разрыва в долях диапазона по оси X, около
+  // тысячной доли пикселя на экране любой ширины
+  const double breakTolerance = 1E-6;
+  const int numPointsPreview = 1000;
+  const int cancelCheckStep = 256;
+  // Количество узлов сетки тепловой карты по каждой оси
+  const std::size_t gridResolution = 1000;
+  const std::size_t gridResolutionPreview = 125;
+  // Сетка вычисляется квадратными блоками, блок - единица работы потока
+  const std::size_t gridTileSize = 64;
+  // Неявные кривые: начальная сетка ячеек по каждой оси и глубина деления
+  // ячеек, через которые проходит кривая
+  const std::size_t implicitBaseCells = 64;
+  const std::size_t implicitDepth = 4;
+  const std::size_t implicitDepthPreview = 2;
+  // Параметрические и полярные кривые: начальная сетка по t, допустимое
+  // расстояние между соседними точками в долях диапазонов осей и глубина
+  // деления шага сетки
+  const std::size_t numPointsCurve = 2000;
+  const std::size_t numPointsCurvePreview = 250;
+  const std::size_t curveBlockSize = 64;
+  const double arcTolerance = 2E-3;
+  const int arcMaxDepth = 12;
+  // Параметр кривых, например угол полярной кривой
+  static constexpr char curveParameter = 't';
+  // Разделитель функций, которые строятся на одном графике
+  static constexpr char expressionDelimiter = ';';
 
   void ResetModelResults() noexcept;
   void NormalizeXRange() noexcept;
   void NormalizeYRange() noexcept;
+  void NormalizeTRange() noexcept;
   void CheckModelData() const;
-  void CalculateHandle();
+  void CompileExpression();
+  void CalculateHandle(int numPoints);
+  void CalculateGridHandle(std::size_t resolution);
+  void CalculateGrid(std::size_t resolution);
+  [[nodiscard]] static double GridNode(double begin, double end,
+                                       std::size_t index,
+                                       std::size_t count) noexcept;
+  static void UpdateZRange(GraphGrid& grid) noexcept;
+  void CalculateCurvesHandle(std::size_t numPoints);
+  void CurvePoint(std::size_t curve, double t,
+                  const std::vector<double>& curveRegisters, double& x,
+                  double& y) const;
+  void RunCurve(double t, std::vector<double>& curveRegisters) const;
+  void RefineArc(std::size_t curve, double t0, double x0, double y0, double t1,
+                 double x1, double y1, double xScale, double yScale, int depth,
+                 std::vector<double>& curveRegisters, std::vector<double>& xs,
+                 std::vector<double>& ys) const;
+  void CalculateImplicitHandle(std::size_t depth);
+  void CalculateContour(std::size_t curve, std::size_t depth);
+  void RefineCell(std::size_t curve, std::size_t column, std::size_t row,
+                  std::size_t size, std::size_t cells,
+                  std::vector<double>& cellRegisters,
+                  std::vector<Interval>& cellIntervalRegisters,
+                  std::vector<contourHelper::Segment>& segments) const;
+  [[nodiscard]] bool IsCancelled() const noexcept;
   void CalculatePoints(double _xBegin, double _xEnd, double numPoints,
-                       double& yMin, double& yMax, int numOfCalcPoints);
-  [[nodiscard]] static bool IsFunctionBreakPoint(double last, double current) noexcept;
+                       double& yMin, double& yMax);
+  void LocateBreak(std::size_t curve, double xLeft, double xRight,
+                   double tolerance, double& yMin, double& yMax);
+  static void UpdateYRange(double y, double& yMin, double& yMax) noexcept;
+  [[nodiscard]] double CalcY(std::size_t curve, double x);
+  [[nodiscard]] static double Finite(double y) noexcept;
+  [[nodiscard]] bool IsFunctionBreakPoint(std::size_t curve, double xLast,
+                                          double xCurrent);
+  [[nodiscard]] static bool IsFunctionBreak(const Interval& y) noexcept;
   void SetYRange(double yMin, double yMax) noexcept;
-
-  MathModel* mathModel;
+  void FindMarkers();
+  static void CollectCurveCandidates(const GraphCurve& curve,
+                                     std::vector<MarkerCandidate>& candidates);
+  static void CollectIntersections(const GraphCurve& first,
+                                   const GraphCurve& second,
+                                   std::vector<MarkerCandidate>& candidates);
+  [[nodiscard]] bool RefineMarker(const MarkerCandidate& candidate,
+                                  std::vector<double>& markerRegisters,
+                                  std::vector<Jet>& markerJetRegisters,
+                                  GraphMarker& marker) const;
+  static void AddPoint(GraphCurve& curve, double x, double y);
+  static void CloseSegment(GraphCurve& curve);
+
+  std::string expression;
+  ExpressionProgram program;
   double xBegin;
   double yBegin;
   double xEnd;
   double yEnd;
+  double tBegin;
+  double tEnd;
   bool yScaleAuto;
-
-  std::vector<std::pair<double, double>> _points;
+  PlotType plotType;
+  int derivativeOrder;
+  bool markersEnabled;
+  const std::atomic<bool>* cancelFlag;
+  std::vector<double> registers;
+  std::vector<Interval> intervalRegisters;
+  std::vector<Jet> jetRegisters;
+
+  GraphResult _result;
 };
 
 }  // namespace s21
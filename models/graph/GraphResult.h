@@ -0,0 +1,81 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALCV2_GRAPHRESULT_H
+#define SMARTCALCV2_GRAPHRESULT_H
+
+#include <cstddef>
+#include <vector>
+
+namespace s21 {
+
+// Точки одной функции графика
+struct GraphCurve final {
+  // Координаты точек по столбцам, только конечные значения
+  std::vector<double> xs;
+  std::vector<double> ys;
+  // Границы непрерывных участков: участок k - это точки с индексами
+  // [bounds[k], bounds[k + 1]). Между участками функция терпит разрыв
+  std::vector<std::size_t> bounds{0};
+  // Номер функции в выражении и порядок производной: 0 - сама функция
+  std::size_t function = 0;
+  int derivative = 0;
+
+  [[nodiscard]] std::size_t SegmentsCount() const noexcept {
+    return bounds.size() - 1;
+  }
+};
+
+// Особая точка графика функции
+struct GraphMarker final {
+  enum Kind { Root, Minimum, Maximum, Intersection };
+
+  Kind kind = Root;
+  double x = 0;
+  double y = 0;
+  // Номер функции, для пересечения - номера обеих функций
+  std::size_t function = 0;
+  std::size_t other = 0;
+};
+
+// Значения функции f(x, y) в узлах равномерной сетки для тепловой карты.
+// Узлы включают границы диапазонов осей, значения хранятся по строкам:
+// строка - значение y, столбец - значение x. Вне области определения - NaN
+struct GraphGrid final {
+  std::size_t columns = 0;
+  std::size_t rows = 0;
+  std::vector<double> values;
+  // Диапазон конечных значений функции на сетке
+  double zMin = 0;
+  double zMax = 0;
+
+  [[nodiscard]] double At(std::size_t row, std::size_t column) const noexcept {
+    return values[row * columns + column];
+  }
+};
+
+// Неизменяемый снимок результата расчета графика. Публикуется рабочим потоком
+// и читается представлением без копирования точек.
+struct GraphResult final {
+  // Диапазон осей, для которого посчитаны точки
+  double xBegin = 0;
+  double xEnd = 0;
+  double yBegin = 0;
+  double yEnd = 0;
+  // false - грубый предварительный расчет, true - окончательный
+  bool isFinal = false;
+  // true - точки функций упорядочены по X, false - точки идут вдоль кривой,
+  // как у линий уровня
+  bool xOrdered = true;
+  // Функции в порядке их записи в выражении
+  std::vector<GraphCurve> curves;
+  // Сетка значений, заполняется только для тепловой карты
+  GraphGrid grid;
+  // Корни, экстремумы и пересечения графиков функций y = f(x)
+  std::vector<GraphMarker> markers;
+};
+
+}  // namespace s21
+
+#endif  // SMARTCALCV2_GRAPHRESULT_H
@@ -0,0 +1,91 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#include "GraphWorker.h"
+
+#include <utility>
+
+#include "../calcException.h"
+
+namespace s21 {
+
+/**
+ * @brief Деструктор класса GraphWorker.
+ *
+ * Отменяет текущий расчет и дожидается завершения рабочего потока.
+ */
+GraphWorker::~GraphWorker() { Stop(); }
+
+/**
+ * @brief Запускает расчет графика в рабочем потоке.
+ *
+ * Предыдущий расчет отменяется, и новый поток стартует только после его
+ * завершения, поэтому устаревший результат не может быть опубликован после
+ * нового. Сначала публикуется грубый предварительный результат, затем
+ * окончательный.
+ *
+ * @param task Модель графика с настройками расчета, принадлежащая потоку.
+ * @param onResult Вызывается из рабочего потока для каждого результата.
+ * @param onError Вызывается из рабочего потока внутри блока catch, поэтому
+ * обработчик может перебросить исключение через `throw;`.
+ */
+void GraphWorker::Run(std::unique_ptr<GraphModel> task, ResultHandler onResult,
+                      ErrorHandler onError) {
+  Stop();
+
+  auto cancelFlag = std::make_shared<std::atomic<bool>>(false);
+  _cancelFlag = cancelFlag;
+
+  _thread = std::thread([task = std::move(task), cancelFlag,
+                         onResult = std::move(onResult),
+                         onError = std::move(onError)]() {
+    task->setCancelFlag(cancelFlag.get());
+
+    try {
+      task->CalculatePreview();
+
+      if (*cancelFlag) {
+        return;
+      }
+
+      onResult(std::make_shared<const GraphResult>(task->TakeResult(false)));
+      task->CalculateGraph();
+
+      if (*cancelFlag) {
+        return;
+      }
+
+      onResult(std::make_shared<const GraphResult>(task->TakeResult(true)));
+    } catch (const CalcException&) {
+      if (!*cancelFlag) {
+        onError();
+      }
+    }
+  });
+}
+
+/**
+ * @brief Запрашивает отмену текущего расчета.
+ *
+ * Рабочий поток проверяет флаг отмены после каждой порции точек.
+ * @note Этот метод не выбрасывает исключений (noexcept).
+ */
+void GraphWorker::Cancel() noexcept {
+  if (_cancelFlag) {
+    *_cancelFlag = true;
+  }
+}
+
+/**
+ * @brief Отменяет текущий расчет и дожидается завершения рабочего потока.
+ */
+void GraphWorker::Stop() {
+  Cancel();
+
+  if (_thread.joinable()) {
+    _thread.join();
+  }
+}
+
+}  // namespace s21
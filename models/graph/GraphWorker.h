@@ -0,0 +1,42 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALCV2_GRAPHWORKER_H
+#define SMARTCALCV2_GRAPHWORKER_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
+
+#include "GraphModel.h"
+#include "GraphResult.h"
+
+namespace s21 {
+
+class GraphWorker final {
+ public:
+  using ResultHandler = std::function<void(std::shared_ptr<const GraphResult>)>;
+  using ErrorHandler = std::function<void()>;
+
+  GraphWorker() = default;
+  GraphWorker(const GraphWorker& other) = delete;
+  GraphWorker(GraphWorker&& other) = delete;
+  GraphWorker& operator=(const GraphWorker& other) = delete;
+  GraphWorker& operator=(GraphWorker&& other) = delete;
+  ~GraphWorker();
+
+  void Run(std::unique_ptr<GraphModel> task, ResultHandler onResult,
+           ErrorHandler onError);
+  void Cancel() noexcept;
+  void Stop();
+
+ private:
+  std::thread _thread;
+  std::shared_ptr<std::atomic<bool>> _cancelFlag;
+};
+
+}  // namespace s21
+
+#endif  // SMARTCALCV2_GRAPHWORKER_H
@@ -0,0 +1,276 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#include "equationSolver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "../../helpers/parallelHelper.h"
+#include "../../helpers/rootHelper.h"
+#include "../calcException.h"
+#include "mathModel.h"
+
+namespace s21 {
+
+/**
+ * @brief Конструктор класса EquationSolver.
+ *
+ * @param expression Левая часть уравнения f(x) = 0.
+ * @throw InputZeroLengthException если выражение пустое.
+ * @throw InputIncorrectException если выражение некорректно.
+ */
+EquationSolver::EquationSolver(const std::string& expression) : program() {
+  MathModel mathModel(expression);
+  program.Append(mathModel.getProgram());
+}
+
+/**
+ * @brief Конструктор класса EquationSolver по уже скомпилированной
+ * программе, например программе калькулятора с настройкой радиан/градусов.
+ *
+ * @param expressionProgram Программа левой части уравнения f(x) = 0.
+ */
+EquationSolver::EquationSolver(const ExpressionProgram& expressionProgram)
+    : program(expressionProgram) {}
+
+/**
+ * @brief Находит все корни уравнения f(x) = 0 на отрезке [a, b].
+ *
+ * Отрезок делится на `cells` равных ячеек, значения функции в узлах
+ * вычисляются параллельно блоками. Корень ищется в каждой ячейке, на концах
+ * которой функция меняет знак, и уточняется методом Ньютона с защитой
+ * делением пополам, производная вычисляется автоматическим
+ * дифференцированием. Корни четной кратности, в которых функция касается
+ * оси без смены знака, ищутся в узлах с локальным минимумом |f| как
+ * экстремумы функции. Смена знака на полюсе корнем не считается: значение
+ * функции в найденной точке должно быть меньше, чем на концах ячейки.
+ * Совпадающие корни соседних ячеек объединяются.
+ *
+ * @param a Начало отрезка.
+ * @param b Конец отрезка.
+ * @param cells Количество ячеек сетки поиска.
+ * @param threads Количество потоков, 0 - по числу ядер.
+ * @return Корни по возрастанию вместе со значениями функции в них.
+ * @throw WrongSolveRangeException если отрезок задан некорректно.
+ * @throw InputIncorrectException если выражение зависит от параметров или y.
+ */
+std::vector<EquationRoot> EquationSolver::Solve(double a, double b,
+                                                std::size_t cells,
+                                                unsigned threads) const {
+  if (!std::isfinite(a) || !std::isfinite(b) || a >= b) {
+    throw WrongSolveRangeException("Incorrect solve range");
+  }
+
+  if (program.HasParameters() || program.UsesY()) {
+    throw InputIncorrectException("Parameter value is not set");
+  }
+
+  cells = std::max<std::size_t>(cells, 1);
+  std::vector<std::vector<EquationRoot>> blockRoots((cells + blockSize - 1) /
+                                                    blockSize);
+
+  parallelHelper::ParallelFor(
+      cells, blockSize,
+      [&](std::size_t begin, std::size_t end) {
+        SolveBlock(begin, end, a, b, cells, blockRoots[begin / blockSize]);
+      },
+      threads);
+
+  std::vector<EquationRoot> roots;
+
+  for (const std::vector<EquationRoot>& block : blockRoots) {
+    roots.insert(roots.end(), block.begin(), block.end());
+  }
+
+  MergeRoots(roots, (b - a) * rootTolerance);
+  return roots;
+}
+
+/**
+ * @brief Ищет корни в ячейках [begin, end) сетки.
+ *
+ * Узел, в котором функция равна нулю, относится к ячейке, которая в нем
+ * начинается, последний узел - к последней ячейке. Для поиска касаний
+ * дополнительно вычисляются соседние узлы за границами блока.
+ *
+ * @param begin Номер первой ячейки блока.
+ * @param end Номер ячейки за последней ячейкой блока.
+ * @param a Начало отрезка.
+ * @param b Конец отрезка.
+ * @param cells Количество ячеек сетки.
+ * @param roots Вектор, в который добавляются корни блока.
+ */
+void EquationSolver::SolveBlock(std::size_t begin, std::size_t end, double a,
+                                double b, std::size_t cells,
+                                std::vector<EquationRoot>& roots) const {
+  std::vector<double> registers;
+  std::vector<Jet> jetRegisters;
+  double tolerance = (b - a) * rootTolerance;
+
+  auto node = [&](std::size_t i) {
+    return i == cells ? b
+                      : a + (b - a) * static_cast<double>(i) /
+                                static_cast<double>(cells);
+  };
+
+  std::size_t first = begin > 0 ? begin - 1 : 0;
+  std::size_t last = std::min(end + 1, cells);
+  std::vector<double> xs(last - first + 1);
+  std::vector<double> ys(xs.size());
+
+  for (std::size_t i = first; i <= last; ++i) {
+    xs[i - first] = node(i);
+    program.Run(xs[i - first], registers);
+    ys[i - first] = program.Output(0, registers);
+  }
+
+  std::size_t lastNode = end == cells ? cells : end - 1;
+
+  for (std::size_t i = begin; i <= lastNode; ++i) {
+    std::size_t k = i - first;
+    double y = ys[k];
+    EquationRoot root;
+
+    if (y == 0) {
+      roots.push_back({xs[k], 0});
+    } else if (i > 0 && i < cells && std::isfinite(y) &&
+               (ys[k - 1] < 0) == (y < 0) && (ys[k + 1] < 0) == (y < 0) &&
+               std::abs(y) < std::abs(ys[k - 1]) &&
+               std::abs(y) <= std::abs(ys[k + 1]) &&
+               std::isfinite(ys[k - 1]) && std::isfinite(ys[k + 1]) &&
+               PolishTouch(xs[k - 1], xs[k + 1],
+                           std::max(std::abs(ys[k - 1]), std::abs(ys[k + 1])),
+                           tolerance, registers, jetRegisters, root)) {
+      roots.push_back(root);
+    }
+
+    if (i < end && y != 0 && ys[k + 1] != 0 && (y < 0) != (ys[k + 1] < 0) &&
+        PolishCrossing(xs[k], xs[k + 1], y, ys[k + 1], tolerance, registers,
+                       jetRegisters, root)) {
+      roots.push_back(root);
+    }
+  }
+}
+
+/**
+ * @brief Уточняет корень в ячейке, на концах которой функция меняет знак.
+ *
+ * @return true если корень найден, false если функция в ячейке не
+ * определена или смена знака вызвана полюсом.
+ */
+bool EquationSolver::PolishCrossing(double xLeft, double xRight, double fLeft,
+                                    double fRight, double tolerance,
+                                    std::vector<double>& registers,
+                                    std::vector<Jet>& jetRegisters,
+                                    EquationRoot& root) const {
+  if (std::isnan(fLeft) || std::isnan(fRight)) {
+    return false;
+  }
+
+  auto function = [&](double x, double& slope) {
+    program.Run(Jet::Variable(x), jetRegisters);
+    const Jet& y = program.Output(0, jetRegisters);
+    slope = y.d1;
+    return y.value;
+  };
+
+  double x = rootHelper::NewtonRoot(function, xLeft, xRight, fLeft, fRight,
+                                    tolerance);
+
+  if (std::isnan(x)) {
+    return false;
+  }
+
+  program.Run(x, registers);
+  double residual = program.Output(0, registers);
+
+  if (!(std::abs(residual) <=
+        std::min(std::abs(fLeft), std::abs(fRight)))) {
+    return false;
+  }
+
+  root = {x, residual};
+  return true;
+}
+
+/**
+ * @brief Ищет корень четной кратности между соседними узлами как экстремум
+ * функции, в котором она обращается в ноль.
+ *
+ * @param scale Наибольшее значение |f| в соседних узлах.
+ * @return true если экстремум найден и значение функции в нем равно нулю с
+ * точностью до погрешности вычисления.
+ */
+bool EquationSolver::PolishTouch(double xLeft, double xRight, double scale,
+                                 double tolerance,
+                                 std::vector<double>& registers,
+                                 std::vector<Jet>& jetRegisters,
+                                 EquationRoot& root) const {
+  auto slope = [&](double x) {
+    program.Run(Jet::Variable(x), jetRegisters);
+    return program.Output(0, jetRegisters).d1;
+  };
+
+  double slopeLeft = slope(xLeft);
+  double slopeRight = slope(xRight);
+
+  if (std::isnan(slopeLeft) || std::isnan(slopeRight) ||
+      (slopeLeft != 0 && slopeRight != 0 &&
+       (slopeLeft < 0) == (slopeRight < 0))) {
+    return false;
+  }
+
+  double x = rootHelper::BrentRoot(slope, xLeft, xRight, slopeLeft,
+                                   slopeRight, tolerance);
+
+  if (std::isnan(x)) {
+    return false;
+  }
+
+  program.Run(x, registers);
+  double residual = program.Output(0, registers);
+
+  if (!(std::abs(residual) <= touchTolerance * std::max(1.0, scale))) {
+    return false;
+  }
+
+  root = {x, residual};
+  return true;
+}
+
+/**
+ * @brief Упорядочивает корни и объединяет совпадающие, оставляя корень с
+ * меньшей невязкой.
+ *
+ * @param roots Корни.
+ * @param tolerance Расстояние, на котором корни считаются совпадающими.
+ */
+void EquationSolver::MergeRoots(std::vector<EquationRoot>& roots,
+                                double tolerance) {
+  const double epsilon = std::numeric_limits<double>::epsilon();
+
+  std::sort(roots.begin(), roots.end(),
+            [](const EquationRoot& lhs, const EquationRoot& rhs) {
+              return lhs.x < rhs.x;
+            });
+
+  std::size_t count = 0;
+
+  for (const EquationRoot& root : roots) {
+    if (count > 0 && root.x - roots[count - 1].x <=
+                         2 * tolerance + 4 * epsilon * std::abs(root.x)) {
+      if (std::abs(root.residual) < std::abs(roots[count - 1].residual)) {
+        roots[count - 1] = root;
+      }
+    } else {
+      roots[count++] = root;
+    }
+  }
+
+  roots.resize(count);
+}
+
+}  // namespace s21
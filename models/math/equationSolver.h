@@ -0,0 +1,63 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALCV2_EQUATIONSOLVER_H
+#define SMARTCALCV2_EQUATIONSOLVER_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "expressionProgram.h"
+
+namespace s21 {
+
+// Корень уравнения f(x) = 0 и значение функции в нем
+struct EquationRoot final {
+  double x = 0;
+  double residual = 0;
+};
+
+class EquationSolver final {
+ public:
+  explicit EquationSolver(const std::string& expression);
+  explicit EquationSolver(const ExpressionProgram& expressionProgram);
+
+  EquationSolver(const EquationSolver& other) = delete;
+  EquationSolver(EquationSolver&& other) = delete;
+  EquationSolver& operator=(const EquationSolver& other) = delete;
+  EquationSolver& operator=(EquationSolver&& other) = delete;
+  ~EquationSolver() = default;
+
+  static constexpr std::size_t defaultCells = 1 << 17;
+
+  [[nodiscard]] std::vector<EquationRoot> Solve(
+      double a, double b, std::size_t cells = defaultCells,
+      unsigned threads = 0) const;
+
+ private:
+  const std::size_t blockSize = 4096;
+  // Точность корней в долях длины отрезка
+  const double rootTolerance = 1E-14;
+  // Допустимое значение функции в корне четной кратности относительно
+  // значений в соседних узлах
+  const double touchTolerance = 1E-12;
+
+  void SolveBlock(std::size_t begin, std::size_t end, double a, double b,
+                  std::size_t cells, std::vector<EquationRoot>& roots) const;
+  bool PolishCrossing(double xLeft, double xRight, double fLeft, double fRight,
+                      double tolerance, std::vector<double>& registers,
+                      std::vector<Jet>& jetRegisters,
+                      EquationRoot& root) const;
+  bool PolishTouch(double xLeft, double xRight, double scale,
+                   double tolerance, std::vector<double>& registers,
+                   std::vector<Jet>& jetRegisters, EquationRoot& root) const;
+  static void MergeRoots(std::vector<EquationRoot>& roots, double tolerance);
+
+  ExpressionProgram program;
+};
+
+}  // namespace s21
+
+#endif  // SMARTCALCV2_EQUATIONSOLVER_H
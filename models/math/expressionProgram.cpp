@@ -0,0 +1,173 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#include "expressionProgram.h"
+
+#include "../calcException.h"
+
+namespace s21 {
+
+/**
+ * @brief Компилирует выражение в обратной польской записи в программу.
+ *
+ * Константы pi и e подставляются значениями, параметр загружается по номеру
+ * буквы, каждая операция становится
+ * инструкцией со ссылками на регистры своих аргументов. Предыдущее
+ * содержимое программы удаляется.
+ *
+ * @param rpnTokens Токены выражения в обратной польской записи.
+ * @throw InputIncorrectException Если аргументов операции не хватает или
+ * после разбора остается не одно значение.
+ */
+void ExpressionProgram::Compile(const std::list<Token>& rpnTokens) {
+  Clear();
+  std::vector<int> stack;
+
+  for (const Token& token : rpnTokens) {
+    Instruction instruction;
+
+    if (token.type == xToken || token.type == yToken) {
+      instruction.op = token.type;
+    } else if (token.type == paramToken) {
+      instruction.op = paramToken;
+      instruction.value = token.value;
+    } else if (token.IsConst()) {
+      instruction.op = numberToken;
+      instruction.value = token.value;
+    } else if (token.IsUnary()) {
+      if (stack.empty()) {
+        Clear();
+        throw InputIncorrectException("Calculate error");
+      }
+
+      instruction.op = token.type;
+      instruction.lhs = stack.back();
+      stack.pop_back();
+    } else if (token.IsBinary()) {
+      if (stack.size() < 2) {
+        Clear();
+        throw InputIncorrectException("Calculate error");
+      }
+
+      instruction.op = token.type;
+      instruction.rhs = stack.back();
+      stack.pop_back();
+      instruction.lhs = stack.back();
+      stack.pop_back();
+    } else {
+      Clear();
+      throw InputIncorrectException("Calculate error");
+    }
+
+    stack.push_back(AddInstruction(instruction));
+  }
+
+  if (stack.size() != 1) {
+    Clear();
+    throw InputIncorrectException("Calculate error");
+  }
+
+  outputs.push_back(stack.back());
+}
+
+/**
+ * @brief Добавляет в программу выражения другой программы.
+ *
+ * Инструкции другой программы переносятся с перенумерацией регистров, а
+ * совпадающие с уже имеющимися инструкции не дублируются. Выходы другой
+ * программы добавляются после выходов этой.
+ *
+ * @param other Программа, выражения которой добавляются.
+ */
+void ExpressionProgram::Append(const ExpressionProgram& other) {
+  std::vector<int> registerMap(other.code.size());
+
+  for (std::size_t i = 0; i < other.code.size(); ++i) {
+    Instruction instruction = other.code[i];
+
+    if (instruction.lhs >= 0) {
+      instruction.lhs = registerMap[instruction.lhs];
+    }
+
+    if (instruction.rhs >= 0) {
+      instruction.rhs = registerMap[instruction.rhs];
+    }
+
+    registerMap[i] = AddInstruction(instruction);
+  }
+
+  for (int output : other.outputs) {
+    outputs.push_back(registerMap[output]);
+  }
+}
+
+/**
+ * @brief Удаляет все инструкции и выходы программы.
+ * @note Этот метод не выбрасывает исключений (noexcept).
+ */
+void ExpressionProgram::Clear() noexcept {
+  code.clear();
+  outputs.clear();
+  instructionIndex.clear();
+  parametersMask = 0;
+  usesX = false;
+  usesY = false;
+}
+
+/**
+ * @brief Возвращает имена параметров, от которых зависит программа.
+ *
+ * @return Буквы параметров в алфавитном порядке.
+ */
+std::string ExpressionProgram::getParameterNames() const {
+  std::string names;
+
+  for (std::size_t i = 0; i < maxParameters; ++i) {
+    if (parametersMask & (1U << i)) {
+      names.push_back(static_cast<char>('a' + i));
+    }
+  }
+
+  return names;
+}
+
+/**
+ * @brief Значения параметров, которые не заданы: все равны NaN.
+ */
+const ExpressionProgram::Parameters& ExpressionProgram::NoParameters() {
+  static const Parameters parameters = [] {
+    Parameters values{};
+    values.fill(std::numeric_limits<double>::quiet_NaN());
+    return values;
+  }();
+  return parameters;
+}
+
+/**
+ * @brief Добавляет инструкцию, если такой же в программе еще нет.
+ *
+ * @param instruction Инструкция с номерами регистров этой программы.
+ * @return Номер регистра с результатом инструкции.
+ */
+int ExpressionProgram::AddInstruction(const Instruction& instruction) {
+  InstructionKey key{instruction.op, instruction.lhs, instruction.rhs,
+                     instruction.value};
+  auto [position, inserted] =
+      instructionIndex.try_emplace(key, static_cast<int>(code.size()));
+
+  if (inserted) {
+    code.push_back(instruction);
+
+    if (instruction.op == paramToken) {
+      parametersMask |= 1U << static_cast<unsigned>(instruction.value);
+    }
+
+    usesX = usesX || instruction.op == xToken;
+    usesY = usesY || instruction.op == yToken;
+  }
+
+  return position->second;
+}
+
+}  // namespace s21
@@ -0,0 +1,262 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALCV2_EXPRESSIONPROGRAM_H
+#define SMARTCALCV2_EXPRESSIONPROGRAM_H
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "../../helpers/mathHelper.h"
+#include "interval.h"
+#include "jet.h"
+#include "token.h"
+
+namespace s21 {
+
+// Выражение, скомпилированное из обратной польской записи в линейную
+// программу. Результат инструкции i хранится в регистре i, аргументы
+// инструкции - номера регистров, вычисленных раньше. Программа вычисляется
+// для любого числового типа: double для точек графика, Interval для оценки
+// функции на отрезке, Jet для значения вместе с производными. Программа
+// может вычислять сразу несколько выражений: каждому соответствует свой
+// выходной регистр, а одинаковые подвыражения вычисляются один раз. Кроме
+// переменных x и y выражение может зависеть от параметров - латинских букв,
+// значения которых передаются при вычислении.
+class ExpressionProgram final {
+ public:
+  static constexpr std::size_t maxParameters = 26;
+  // Значения параметров по номеру буквы в алфавите
+  using Parameters = std::array<double, maxParameters>;
+
+  struct Instruction {
+    TokenType op = unknownToken;
+    int lhs = -1;
+    int rhs = -1;
+    double value = 0;
+  };
+
+  ExpressionProgram() = default;
+
+  void Compile(const std::list<Token>& rpnTokens);
+  void Append(const ExpressionProgram& other);
+  void Clear() noexcept;
+  void setRadDegFactor(double factor) noexcept { radDegFactor = factor; }
+
+  [[nodiscard]] bool IsEmpty() const noexcept { return code.empty(); }
+  [[nodiscard]] std::size_t Size() const noexcept { return code.size(); }
+  [[nodiscard]] std::size_t OutputsCount() const noexcept {
+    return outputs.size();
+  }
+  [[nodiscard]] bool HasParameters() const noexcept {
+    return parametersMask != 0;
+  }
+  [[nodiscard]] bool UsesX() const noexcept { return usesX; }
+  [[nodiscard]] bool UsesY() const noexcept { return usesY; }
+  [[nodiscard]] std::string getParameterNames() const;
+  static const Parameters& NoParameters();
+
+  template <class T>
+  void Run(const T& x, std::vector<T>& registers) const;
+  template <class T>
+  void Run(const T& x, const Parameters& parameters,
+           std::vector<T>& registers) const;
+  template <class T>
+  void Run(const T& x, const T& y, const Parameters& parameters,
+           std::vector<T>& registers) const;
+  template <class T>
+  const T& Output(std::size_t index, const std::vector<T>& registers) const {
+    return registers[outputs[index]];
+  }
+  template <class T>
+  T Evaluate(const T& x, std::vector<T>& registers) const;
+  template <class T>
+  T Evaluate(const T& x) const;
+
+ private:
+  using InstructionKey = std::tuple<TokenType, int, int, double>;
+
+  int AddInstruction(const Instruction& instruction);
+
+  template <class T>
+  T UnaryOp(const T& value, TokenType type) const;
+  template <class T>
+  static T BinaryOp(const T& lhs, const T& rhs, TokenType type);
+
+  std::vector<Instruction> code;
+  std::vector<int> outputs;
+  std::map<InstructionKey, int> instructionIndex;
+  std::uint32_t parametersMask = 0;
+  bool usesX = false;
+  bool usesY = false;
+  double radDegFactor = 1;
+};
+
+/**
+ * @brief Вычисляет все регистры программы для значения переменной x.
+ *
+ * Параметры выражения при этом равны NaN.
+ *
+ * @param x Значение переменной x.
+ * @param registers Буфер регистров.
+ */
+template <class T>
+void ExpressionProgram::Run(const T& x, std::vector<T>& registers) const {
+  Run(x, NoParameters(), registers);
+}
+
+/**
+ * @brief Вычисляет все регистры программы для значений переменной x и
+ * параметров. Переменная y при этом равна NaN.
+ *
+ * @param x Значение переменной x.
+ * @param parameters Значения параметров по номеру буквы в алфавите.
+ * @param registers Буфер регистров.
+ */
+template <class T>
+void ExpressionProgram::Run(const T& x, const Parameters& parameters,
+                            std::vector<T>& registers) const {
+  Run(x, T(std::numeric_limits<double>::quiet_NaN()), parameters, registers);
+}
+
+/**
+ * @brief Вычисляет все регистры программы для значений переменных x, y и
+ * параметров.
+ *
+ * Значения выражений затем читаются из регистров методом `Output()`.
+ *
+ * @param x Значение переменной x.
+ * @param y Значение переменной y.
+ * @param parameters Значения параметров по номеру буквы в алфавите.
+ * @param registers Буфер регистров, переиспользуется между вызовами, чтобы не
+ * выделять память на каждую точку.
+ */
+template <class T>
+void ExpressionProgram::Run(const T& x, const T& y,
+                            const Parameters& parameters,
+                            std::vector<T>& registers) const {
+  registers.resize(code.size());
+
+  for (std::size_t i = 0; i < code.size(); ++i) {
+    const Instruction& instruction = code[i];
+
+    switch (instruction.op) {
+      case numberToken:
+        registers[i] = T(instruction.value);
+        break;
+      case xToken:
+        registers[i] = x;
+        break;
+      case yToken:
+        registers[i] = y;
+        break;
+      case paramToken:
+        registers[i] =
+            T(parameters[static_cast<std::size_t>(instruction.value)]);
+        break;
+      default:
+        if (instruction.rhs >= 0) {
+          registers[i] = BinaryOp(registers[instruction.lhs],
+                                  registers[instruction.rhs], instruction.op);
+        } else {
+          registers[i] = UnaryOp(registers[instruction.lhs], instruction.op);
+        }
+        break;
+    }
+  }
+}
+
+/**
+ * @brief Вычисляет первое выражение программы для значения переменной x.
+ *
+ * @param x Значение переменной x.
+ * @param registers Буфер регистров.
+ * @return Значение первого выражения.
+ */
+template <class T>
+T ExpressionProgram::Evaluate(const T& x, std::vector<T>& registers) const {
+  Run(x, registers);
+  return Output(0, registers);
+}
+
+template <class T>
+T ExpressionProgram::Evaluate(const T& x) const {
+  std::vector<T> registers;
+  return Evaluate(x, registers);
+}
+
+/**
+ * @brief Выполняет унарную операцию над значением.
+ *
+ * Функции ищутся по типу аргумента: для double вызываются функции std, для
+ * Interval и Jet - их интервальные версии и версии с производными.
+ */
+template <class T>
+T ExpressionProgram::UnaryOp(const T& value, TokenType type) const {
+  using std::acos, std::asin, std::atan, std::cos, std::log, std::log10,
+      std::sin, std::sqrt, std::tan, mathHelper::Factorial;
+
+  switch (type) {
+    case unMinusToken:
+      return T(0) - value;
+    case cosToken:
+      return cos(value * T(radDegFactor));
+    case sinToken:
+      return sin(value * T(radDegFactor));
+    case tanToken:
+      return tan(value * T(radDegFactor));
+    case acosToken:
+      return acos(value);
+    case asinToken:
+      return asin(value);
+    case atanToken:
+      return atan(value);
+    case sqrtToken:
+      return sqrt(value);
+    case lnToken:
+      return log(value);
+    case logToken:
+      return log10(value);
+    case factorialToken:
+      return Factorial(value);
+    default:
+      return T(0);
+  }
+}
+
+/**
+ * @brief Выполняет бинарную операцию над двумя значениями.
+ */
+template <class T>
+T ExpressionProgram::BinaryOp(const T& lhs, const T& rhs, TokenType type) {
+  using std::fmod, std::pow;
+
+  switch (type) {
+    case addToken:
+      return lhs + rhs;
+    case subToken:
+      return lhs - rhs;
+    case divToken:
+      return lhs / rhs;
+    case mulToken:
+      return lhs * rhs;
+    case powToken:
+      return pow(lhs, rhs);
+    case modToken:
+      return fmod(lhs, rhs);
+    default:
+      return T(0);
+  }
+}
+
+}  // namespace s21
+
+#endif  // SMARTCALCV2_EXPRESSIONPROGRAM_H
@@ -0,0 +1,285 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#include "integrator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "../../helpers/parallelHelper.h"
+#include "../calcException.h"
+#include "mathModel.h"
+
+namespace s21 {
+
+namespace {
+
+// Узлы правила Кронрода по 15 точкам на [-1, 1] по убыванию, узлы с
+// нечетными номерами - узлы правила Гаусса по 7 точкам
+const double kronrodNodes[8] = {
+    0.991455371120812639206854697526329, 0.949107912342758524526189684047851,
+    0.864864423359769072789712788640926, 0.741531185599394439863864773280788,
+    0.586087235467691130294144845693013, 0.405845151377397166906606412076961,
+    0.207784955007898467600689403773245, 0.000000000000000000000000000000000};
+const double kronrodWeights[8] = {
+    0.022935322010529224963732008058970, 0.063092092629978553290700663189204,
+    0.104790010322250183839876322541518, 0.140653259715525918745189590510238,
+    0.169004726639267902826583426598550, 0.190350578064785409913256402421014,
+    0.204432940075298892414161999234649, 0.209482141084727828012999174891714};
+const double gaussWeights[4] = {
+    0.129484966168869693270611432679082, 0.279705391489276667901467771423780,
+    0.381830050505118944950369775488975, 0.417959183673469387755102040816327};
+
+const std::size_t kronrodPoints = 15;
+
+}  // namespace
+
+/**
+ * @brief Конструктор класса Integrator.
+ *
+ * @param expression Подынтегральное выражение от x.
+ * @throw InputZeroLengthException если выражение пустое.
+ * @throw InputIncorrectException если выражение некорректно.
+ */
+Integrator::Integrator(const std::string& expression) : program() {
+  MathModel mathModel(expression);
+  program.Append(mathModel.getProgram());
+}
+
+/**
+ * @brief Конструктор класса Integrator по уже скомпилированной программе.
+ *
+ * @param expressionProgram Программа подынтегрального выражения.
+ */
+Integrator::Integrator(const ExpressionProgram& expressionProgram)
+    : program(expressionProgram) {}
+
+/**
+ * @brief Вычисляет определенный интеграл на отрезке [a, b] адаптивной
+ * квадратурой Гаусса-Кронрода.
+ *
+ * Интеграл по каждому подотрезку оценивается правилом Кронрода по 15
+ * точкам, погрешность - по разности с вложенным правилом Гаусса по 7 точкам,
+ * как в QUADPACK. Подотрезки хранятся в куче по убыванию погрешности. За
+ * один проход из кучи берутся до `batchSize` худших подотрезков, делятся
+ * пополам, и половины вычисляются параллельно. Проходы повторяются, пока
+ * суммарная погрешность больше допустимой и количество подотрезков не
+ * превышает `maxIntervals`.
+ *
+ * @param a Нижний предел.
+ * @param b Верхний предел, может быть меньше нижнего.
+ * @param threads Количество потоков, 0 - по числу ядер.
+ * @return Значение интеграла, оценка погрешности и признак достижения
+ * заданной точности.
+ * @throw WrongIntegralRangeException если пределы не конечны.
+ * @throw InputIncorrectException если выражение зависит от параметров или y.
+ */
+IntegralResult Integrator::Integrate(double a, double b,
+                                     unsigned threads) const {
+  if (!std::isfinite(a) || !std::isfinite(b)) {
+    throw WrongIntegralRangeException("Integration limits must be finite");
+  }
+
+  if (program.HasParameters() || program.UsesY()) {
+    throw InputIncorrectException("Parameter value is not set");
+  }
+
+  IntegralResult result;
+
+  if (a == b) {
+    result.converged = true;
+    return result;
+  }
+
+  double sign = a < b ? 1 : -1;
+  double low = std::min(a, b);
+  double high = std::max(a, b);
+
+  auto worse = [](const Segment& lhs, const Segment& rhs) {
+    return lhs.error < rhs.error;
+  };
+
+  std::vector<Segment> heap;
+  std::vector<Segment> finished;
+  std::vector<Segment> halves(initialIntervals);
+  double value = 0;
+  double error = 0;
+
+  for (std::size_t i = 0; i < initialIntervals; ++i) {
+    halves[i].a = low + (high - low) * static_cast<double>(i) /
+                            static_cast<double>(initialIntervals);
+    halves[i].b = i + 1 == initialIntervals
+                      ? high
+                      : low + (high - low) * static_cast<double>(i + 1) /
+                                  static_cast<double>(initialIntervals);
+  }
+
+  while (!halves.empty()) {
+    EvaluateSegments(halves, threads);
+    result.evaluations += kronrodPoints * halves.size();
+
+    for (const Segment& half : halves) {
+      value += half.value;
+      error += half.error;
+
+      if (IsSplittable(half)) {
+        heap.push_back(half);
+        std::push_heap(heap.begin(), heap.end(), worse);
+      } else {
+        finished.push_back(half);
+      }
+    }
+
+    halves.clear();
+    double tolerance = std::max(absTolerance, relTolerance * std::abs(value));
+    std::size_t intervals = heap.size() + finished.size();
+
+    if (std::isnan(value) || error <= tolerance || intervals >= maxIntervals) {
+      break;
+    }
+
+    // Делятся худшие подотрезки, пока их суммарная погрешность не покроет
+    // превышение допустимой: у особенности это один подотрезок, у
+    // осциллирующей функции - целый пакет
+    std::size_t batch =
+        std::min({batchSize, heap.size(), maxIntervals - intervals});
+    double excess = error - tolerance;
+
+    for (std::size_t i = 0; i < batch && excess > 0; ++i) {
+      std::pop_heap(heap.begin(), heap.end(), worse);
+      Segment worst = heap.back();
+      heap.pop_back();
+      value -= worst.value;
+      error -= worst.error;
+      excess -= worst.error;
+
+      double middle = (worst.a + worst.b) / 2;
+      halves.push_back({worst.a, middle, 0, 0});
+      halves.push_back({middle, worst.b, 0, 0});
+    }
+  }
+
+  // Суммы, накопленные вычитанием, пересчитываются заново
+  result.value = 0;
+  result.error = 0;
+
+  for (const std::vector<Segment>* segments : {&heap, &finished}) {
+    for (const Segment& segment : *segments) {
+      result.value += segment.value;
+      result.error += segment.error;
+    }
+  }
+
+  result.value *= sign;
+  result.intervals = heap.size() + finished.size();
+  result.converged =
+      result.error <=
+      std::max(absTolerance, relTolerance * std::abs(result.value));
+  return result;
+}
+
+/**
+ * @brief Вычисляет интегралы по подотрезкам параллельно, у каждого блока
+ * подотрезков свой буфер регистров.
+ *
+ * @param segments Подотрезки с заданными концами.
+ * @param threads Количество потоков, 0 - по числу ядер.
+ */
+void Integrator::EvaluateSegments(std::vector<Segment>& segments,
+                                  unsigned threads) const {
+  parallelHelper::ParallelFor(
+      segments.size(), parallelGrain,
+      [&](std::size_t begin, std::size_t end) {
+        std::vector<double> registers;
+
+        for (std::size_t i = begin; i < end; ++i) {
+          segments[i] = Kronrod(segments[i].a, segments[i].b, registers);
+        }
+      },
+      threads);
+}
+
+/**
+ * @brief Вычисляет интеграл по отрезку правилом Кронрода по 15 точкам и
+ * оценивает погрешность по правилу Гаусса по 7 точкам.
+ *
+ * Оценка погрешности масштабируется так же, как в QK15 из QUADPACK: для
+ * гладких функций разность правил сильно завышает погрешность, а снизу она
+ * ограничена погрешностью округления.
+ *
+ * @param a Начало отрезка.
+ * @param b Конец отрезка.
+ * @param registers Буфер регистров программы.
+ * @return Подотрезок с оценками интеграла и погрешности.
+ */
+Integrator::Segment Integrator::Kronrod(double a, double b,
+                                        std::vector<double>& registers) const {
+  auto function = [&](double x) {
+    program.Run(x, registers);
+    return program.Output(0, registers);
+  };
+
+  const double epsilon = std::numeric_limits<double>::epsilon();
+  double center = (a + b) / 2;
+  double halfLength = (b - a) / 2;
+  double values[2][7];
+
+  double fCenter = function(center);
+  double gauss = fCenter * gaussWeights[3];
+  double kronrod = fCenter * kronrodWeights[7];
+  double absolute = std::abs(kronrod);
+
+  for (int j = 0; j < 7; ++j) {
+    double offset = halfLength * kronrodNodes[j];
+    double fLeft = function(center - offset);
+    double fRight = function(center + offset);
+    values[0][j] = fLeft;
+    values[1][j] = fRight;
+    kronrod += kronrodWeights[j] * (fLeft + fRight);
+    absolute += kronrodWeights[j] * (std::abs(fLeft) + std::abs(fRight));
+
+    if (j % 2 == 1) {
+      gauss += gaussWeights[j / 2] * (fLeft + fRight);
+    }
+  }
+
+  double mean = kronrod / 2;
+  double deviation = kronrodWeights[7] * std::abs(fCenter - mean);
+
+  for (int j = 0; j < 7; ++j) {
+    deviation += kronrodWeights[j] * (std::abs(values[0][j] - mean) +
+                                      std::abs(values[1][j] - mean));
+  }
+
+  Segment segment;
+  segment.a = a;
+  segment.b = b;
+  segment.value = kronrod * halfLength;
+  absolute *= halfLength;
+  deviation *= halfLength;
+  segment.error = std::abs((kronrod - gauss) * halfLength);
+
+  if (deviation != 0 && segment.error != 0) {
+    double ratio = 200 * segment.error / deviation;
+    segment.error = deviation * std::min(1.0, std::pow(ratio, 1.5));
+  }
+
+  segment.error = std::max(50 * epsilon * absolute, segment.error);
+  return segment;
+}
+
+/**
+ * @brief Проверяет, что подотрезок можно разделить пополам: середина
+ * отличается от концов, а погрешность определена.
+ */
+bool Integrator::IsSplittable(const Segment& segment) noexcept {
+  const double epsilon = std::numeric_limits<double>::epsilon();
+  double middle = (segment.a + segment.b) / 2;
+  double scale = std::max(std::abs(segment.a), std::abs(segment.b));
+  return std::isfinite(segment.error) && segment.a < middle &&
+         middle < segment.b && segment.b - segment.a > 1E3 * epsilon * scale;
+}
+
+}  // namespace s21
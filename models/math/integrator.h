@@ -0,0 +1,67 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALCV2_INTEGRATOR_H
+#define SMARTCALCV2_INTEGRATOR_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "expressionProgram.h"
+
+namespace s21 {
+
+// Значение определенного интеграла и оценка его погрешности
+struct IntegralResult final {
+  double value = 0;
+  double error = 0;
+  std::size_t intervals = 0;
+  std::size_t evaluations = 0;
+  bool converged = false;
+};
+
+class Integrator final {
+ public:
+  explicit Integrator(const std::string& expression);
+  explicit Integrator(const ExpressionProgram& expressionProgram);
+
+  Integrator(const Integrator& other) = delete;
+  Integrator(Integrator&& other) = delete;
+  Integrator& operator=(const Integrator& other) = delete;
+  Integrator& operator=(Integrator&& other) = delete;
+  ~Integrator() = default;
+
+  [[nodiscard]] IntegralResult Integrate(double a, double b,
+                                         unsigned threads = 0) const;
+
+ private:
+  // Подотрезок с оценкой интеграла Гаусса-Кронрода по 15 точкам
+  struct Segment {
+    double a = 0;
+    double b = 0;
+    double value = 0;
+    double error = 0;
+  };
+
+  const double absTolerance = 1E-12;
+  const double relTolerance = 1E-10;
+  const std::size_t initialIntervals = 16;
+  // Сколько худших подотрезков делится пополам за один проход
+  const std::size_t batchSize = 256;
+  // Меньше стольких подотрезков вычисляются в одном потоке
+  const std::size_t parallelGrain = 16;
+  const std::size_t maxIntervals = 1 << 16;
+
+  void EvaluateSegments(std::vector<Segment>& segments,
+                        unsigned threads) const;
+  Segment Kronrod(double a, double b, std::vector<double>& registers) const;
+  [[nodiscard]] static bool IsSplittable(const Segment& segment) noexcept;
+
+  ExpressionProgram program;
+};
+
+}  // namespace s21
+
+#endif  // SMARTCALCV2_INTEGRATOR_H
@@ -0,0 +1,521 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#include "interval.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "../../helpers/mathHelper.h"
+
+namespace s21 {
+
+namespace {
+
+constexpr double kInf = std::numeric_limits<double>::infinity();
+constexpr double kNaN = std::numeric_limits<double>::quiet_NaN();
+constexpr double kPi = 3.14159265358979323846264338327950288;
+
+/**
+ * @brief Собирает результат операции с округлением границ наружу.
+ *
+ * Результаты библиотечных функций отличаются от точных не более чем на
+ * несколько ulp, поэтому границы сдвигаются на ulp наружу. Неопределенная
+ * граница (например, inf - inf) заменяется бесконечностью. Неограниченный
+ * интервал не доказывает непрерывность, поэтому флаг continuous для него
+ * сбрасывается.
+ *
+ * @param lo Нижняя граница.
+ * @param hi Верхняя граница.
+ * @param defined Функция определена на всем отрезке аргумента.
+ * @param continuous Функция непрерывна на всем отрезке аргумента.
+ * @return Интервал результата.
+ */
+Interval Rounded(double lo, double hi, bool defined, bool continuous) {
+  lo = std::isnan(lo) ? -kInf : std::nextafter(lo, -kInf);
+  hi = std::isnan(hi) ? kInf : std::nextafter(hi, kInf);
+  continuous = continuous && defined && std::isfinite(lo) && std::isfinite(hi);
+  return {lo, hi, defined, continuous};
+}
+
+/**
+ * @brief Результат операции над точечными аргументами.
+ *
+ * Значение вычисляется той же операцией над double, что и при обычном
+ * расчете, поэтому точечный интервал совпадает с отрисованной точкой.
+ * Бесконечный результат на графике не отображается и считается
+ * неопределенным.
+ */
+Interval PointResult(double value) {
+  if (!std::isfinite(value)) {
+    return Interval::Empty();
+  }
+
+  return Interval(value);
+}
+
+/**
+ * @brief Возвращает пересечение флагов двух аргументов операции.
+ */
+bool BothDefined(const Interval& lhs, const Interval& rhs) {
+  return lhs.defined && rhs.defined;
+}
+
+bool BothContinuous(const Interval& lhs, const Interval& rhs) {
+  return lhs.continuous && rhs.continuous;
+}
+
+/**
+ * @brief Проверяет, попадает ли в [lo, hi] точка вида phase + k * period.
+ */
+bool ContainsPeriodic(double lo, double hi, double phase, double period) {
+  double k = std::ceil((lo - phase) / period);
+  return phase + k * period <= hi;
+}
+
+/**
+ * @brief Произведение границ, в котором 0 * inf считается равным 0.
+ */
+double MulBounds(double lhs, double rhs) {
+  return lhs == 0 || rhs == 0 ? 0.0 : lhs * rhs;
+}
+
+/**
+ * @brief Применяет возрастающую функцию к интервалу.
+ */
+template <class Function>
+Interval Increasing(const Interval& value, double lo, double hi,
+                    Function function, bool defined) {
+  return Rounded(function(lo), function(hi), value.defined && defined,
+                 value.continuous);
+}
+
+}  // namespace
+
+/**
+ * @brief Создает точечный интервал [value, value].
+ * @param value Значение.
+ */
+Interval::Interval(double value) : lo(value), hi(value) {}
+
+/**
+ * @brief Создает интервал с заданными границами и флагами.
+ * @param lo Нижняя граница.
+ * @param hi Верхняя граница.
+ * @param defined Функция определена на всем отрезке аргумента.
+ * @param continuous Функция непрерывна на всем отрезке аргумента.
+ */
+Interval::Interval(double lo, double hi, bool defined, bool continuous)
+    : lo(lo), hi(hi), defined(defined), continuous(continuous) {}
+
+/**
+ * @brief Пустой интервал: функция нигде на отрезке не определена.
+ */
+Interval Interval::Empty() { return {kNaN, kNaN, false, false}; }
+
+/**
+ * @brief Вся числовая прямая. Ничего не известно о значениях функции,
+ * непрерывность не доказана.
+ * @param defined Функция определена на всем отрезке аргумента.
+ */
+Interval Interval::Entire(bool defined) { return {-kInf, kInf, defined, false}; }
+
+/**
+ * @brief Проверяет, пуст ли интервал.
+ * @note Этот метод не выбрасывает исключений (noexcept).
+ */
+bool Interval::IsEmpty() const noexcept { return std::isnan(lo); }
+
+/**
+ * @brief Проверяет, принадлежит ли значение интервалу.
+ * @note Этот метод не выбрасывает исключений (noexcept).
+ */
+bool Interval::Contains(double value) const noexcept {
+  return lo <= value && value <= hi;
+}
+
+Interval operator-(const Interval& value) {
+  return {-value.hi, -value.lo, value.defined, value.continuous};
+}
+
+Interval operator+(const Interval& lhs, const Interval& rhs) {
+  if (lhs.IsEmpty() || rhs.IsEmpty()) {
+    return Interval::Empty();
+  }
+
+  if (lhs.IsPoint() && rhs.IsPoint()) {
+    return PointResult(lhs.lo + rhs.lo);
+  }
+
+  return Rounded(lhs.lo + rhs.lo, lhs.hi + rhs.hi, BothDefined(lhs, rhs),
+                 BothContinuous(lhs, rhs));
+}
+
+Interval operator-(const Interval& lhs, const Interval& rhs) {
+  if (lhs.IsEmpty() || rhs.IsEmpty()) {
+    return Interval::Empty();
+  }
+
+  if (lhs.IsPoint() && rhs.IsPoint()) {
+    return PointResult(lhs.lo - rhs.lo);
+  }
+
+  return Rounded(lhs.lo - rhs.hi, lhs.hi - rhs.lo, BothDefined(lhs, rhs),
+                 BothContinuous(lhs, rhs));
+}
+
+Interval operator*(const Interval& lhs, const Interval& rhs) {
+  if (lhs.IsEmpty() || rhs.IsEmpty()) {
+    return Interval::Empty();
+  }
+
+  if (lhs.IsPoint() && rhs.IsPoint()) {
+    return PointResult(lhs.lo * rhs.lo);
+  }
+
+  double products[4] = {
+      MulBounds(lhs.lo, rhs.lo), MulBounds(lhs.lo, rhs.hi),
+      MulBounds(lhs.hi, rhs.lo), MulBounds(lhs.hi, rhs.hi)};
+  auto [lo, hi] = std::minmax_element(products, products + 4);
+  return Rounded(*lo, *hi, BothDefined(lhs, rhs), BothContinuous(lhs, rhs));
+}
+
+/**
+ * @brief Деление интервалов.
+ *
+ * Если делитель содержит ноль, у функции на отрезке полюс или точка, где она
+ * не определена, поэтому результат - вся прямая без гарантии непрерывности.
+ */
+Interval operator/(const Interval& lhs, const Interval& rhs) {
+  if (lhs.IsEmpty() || rhs.IsEmpty()) {
+    return Interval::Empty();
+  }
+
+  if (lhs.IsPoint() && rhs.IsPoint()) {
+    return PointResult(lhs.lo / rhs.lo);
+  }
+
+  if (rhs.Contains(0)) {
+    return rhs.IsPoint() ? Interval::Empty() : Interval::Entire();
+  }
+
+  double quotients[4] = {lhs.lo / rhs.lo, lhs.lo / rhs.hi, lhs.hi / rhs.lo,
+                         lhs.hi / rhs.hi};
+  auto [lo, hi] = std::minmax_element(quotients, quotients + 4);
+  return Rounded(*lo, *hi, BothDefined(lhs, rhs), BothContinuous(lhs, rhs));
+}
+
+/**
+ * @brief Возведение интервала в степень.
+ *
+ * Целая степень считается для любого знака основания, в остальных случаях
+ * функция определена только при неотрицательном основании.
+ */
+Interval pow(const Interval& base, const Interval& exponent) {
+  if (base.IsEmpty() || exponent.IsEmpty()) {
+    return Interval::Empty();
+  }
+
+  if (base.IsPoint() && exponent.IsPoint()) {
+    return PointResult(std::pow(base.lo, exponent.lo));
+  }
+
+  bool defined = BothDefined(base, exponent);
+  bool continuous = BothContinuous(base, exponent);
+
+  if (exponent.IsPoint() && exponent.lo == std::trunc(exponent.lo)) {
+    double n = exponent.lo;
+    double atLo = std::pow(base.lo, n);
+    double atHi = std::pow(base.hi, n);
+
+    if (n == 0) {
+      return {1, 1, defined, continuous};
+    }
+
+    if (n < 0 && base.Contains(0)) {
+      return Interval::Entire();
+    }
+
+    if (n > 0 && std::fmod(n, 2) == 0 && base.lo < 0 && base.hi > 0) {
+      return Rounded(0, std::max(atLo, atHi), defined, continuous);
+    }
+
+    return Rounded(std::min(atLo, atHi), std::max(atLo, atHi), defined,
+                   continuous);
+  }
+
+  if (base.hi < 0) {
+    return exponent.IsPoint() ? Interval::Empty() : Interval::Entire();
+  }
+
+  if (base.lo < 0) {
+    if (!exponent.IsPoint()) {
+      return Interval::Entire();
+    }
+
+    defined = false;
+  }
+
+  double lo = std::max(base.lo, 0.0);
+  double corners[4] = {std::pow(lo, exponent.lo), std::pow(lo, exponent.hi),
+                       std::pow(base.hi, exponent.lo),
+                       std::pow(base.hi, exponent.hi)};
+  auto [min, max] = std::minmax_element(corners, corners + 4);
+
+  if (lo == 0 && exponent.lo < 0) {
+    return Interval::Entire();
+  }
+
+  if (lo == 0 && !exponent.IsPoint() && exponent.Contains(0)) {
+    continuous = false;
+  }
+
+  return Rounded(*min, *max, defined, continuous);
+}
+
+/**
+ * @brief Остаток от деления интервалов.
+ *
+ * Остаток непрерывен, только если частное на всем отрезке не переходит через
+ * целое число. Иначе функция имеет скачки, а результат ограничен модулем
+ * делителя.
+ */
+Interval fmod(const Interval& lhs, const Interval& rhs) {
+  if (lhs.IsEmpty() || rhs.IsEmpty()) {
+    return Interval::Empty();
+  }
+
+  if (lhs.IsPoint() && rhs.IsPoint()) {
+    return PointResult(std::fmod(lhs.lo, rhs.lo));
+  }
+
+  if (rhs.IsPoint() && rhs.lo == 0) {
+    return Interval::Empty();
+  }
+
+  bool defined = BothDefined(lhs, rhs) && !rhs.Contains(0);
+  double modulus = std::max(std::abs(rhs.lo), std::abs(rhs.hi));
+
+  if (rhs.IsPoint() && std::isfinite(lhs.lo) && std::isfinite(lhs.hi)) {
+    double atLo = std::fmod(lhs.lo, modulus);
+    double atHi = std::fmod(lhs.hi, modulus);
+
+    if (std::trunc(lhs.lo / modulus) == std::trunc(lhs.hi / modulus) &&
+        atLo <= atHi) {
+      return Rounded(atLo, atHi, defined, BothContinuous(lhs, rhs));
+    }
+  }
+
+  double lo = lhs.lo >= 0 ? 0.0 : -modulus;
+  double hi = lhs.hi <= 0 ? 0.0 : modulus;
+  return {lo, hi, defined, false};
+}
+
+Interval sin(const Interval& value) {
+  if (value.IsEmpty()) {
+    return Interval::Empty();
+  }
+
+  if (value.IsPoint()) {
+    return PointResult(std::sin(value.lo));
+  }
+
+  if (!(value.hi - value.lo < 2 * kPi)) {
+    return {-1, 1, value.defined, value.continuous};
+  }
+
+  double atLo = std::sin(value.lo);
+  double atHi = std::sin(value.hi);
+  double lo = ContainsPeriodic(value.lo, value.hi, -kPi / 2, 2 * kPi)
+                  ? -1.0
+                  : std::min(atLo, atHi);
+  double hi = ContainsPeriodic(value.lo, value.hi, kPi / 2, 2 * kPi)
+                  ? 1.0
+                  : std::max(atLo, atHi);
+  Interval result = Rounded(lo, hi, value.defined, value.continuous);
+  result.lo = std::max(result.lo, -1.0);
+  result.hi = std::min(result.hi, 1.0);
+  return result;
+}
+
+Interval cos(const Interval& value) {
+  if (value.IsEmpty()) {
+    return Interval::Empty();
+  }
+
+  if (value.IsPoint()) {
+    return PointResult(std::cos(value.lo));
+  }
+
+  if (!(value.hi - value.lo < 2 * kPi)) {
+    return {-1, 1, value.defined, value.continuous};
+  }
+
+  double atLo = std::cos(value.lo);
+  double atHi = std::cos(value.hi);
+  double lo = ContainsPeriodic(value.lo, value.hi, kPi, 2 * kPi)
+                  ? -1.0
+                  : std::min(atLo, atHi);
+  double hi = ContainsPeriodic(value.lo, value.hi, 0, 2 * kPi)
+                  ? 1.0
+                  : std::max(atLo, atHi);
+  Interval result = Rounded(lo, hi, value.defined, value.continuous);
+  result.lo = std::max(result.lo, -1.0);
+  result.hi = std::min(result.hi, 1.0);
+  return result;
+}
+
+/**
+ * @brief Тангенс интервала.
+ *
+ * Если отрезок содержит полюс pi/2 + k*pi, результат - вся прямая без
+ * гарантии непрерывности, иначе тангенс на отрезке возрастает.
+ */
+Interval tan(const Interval& value) {
+  if (value.IsEmpty()) {
+    return Interval::Empty();
+  }
+
+  if (value.IsPoint()) {
+    return PointResult(std::tan(value.lo));
+  }
+
+  if (!(value.hi - value.lo < kPi) ||
+      ContainsPeriodic(value.lo, value.hi, kPi / 2, kPi)) {
+    return Interval::Entire();
+  }
+
+  double atLo = std::tan(value.lo);
+  double atHi = std::tan(value.hi);
+
+  if (atLo > atHi) {
+    return Interval::Entire();
+  }
+
+  return Rounded(atLo, atHi, value.defined, value.continuous);
+}
+
+Interval asin(const Interval& value) {
+  if (value.IsEmpty() || value.hi < -1 || value.lo > 1) {
+    return Interval::Empty();
+  }
+
+  if (value.IsPoint()) {
+    return PointResult(std::asin(value.lo));
+  }
+
+  return Increasing(
+      value, std::max(value.lo, -1.0), std::min(value.hi, 1.0),
+      [](double v) { return std::asin(v); },
+      value.lo >= -1 && value.hi <= 1);
+}
+
+Interval acos(const Interval& value) {
+  if (value.IsEmpty() || value.hi < -1 || value.lo > 1) {
+    return Interval::Empty();
+  }
+
+  if (value.IsPoint()) {
+    return PointResult(std::acos(value.lo));
+  }
+
+  return Increasing(
+      value, -std::min(value.hi, 1.0), -std::max(value.lo, -1.0),
+      [](double v) { return std::acos(-v); },
+      value.lo >= -1 && value.hi <= 1);
+}
+
+Interval atan(const Interval& value) {
+  if (value.IsEmpty()) {
+    return Interval::Empty();
+  }
+
+  if (value.IsPoint()) {
+    return PointResult(std::atan(value.lo));
+  }
+
+  return Increasing(
+      value, value.lo, value.hi, [](double v) { return std::atan(v); }, true);
+}
+
+Interval sqrt(const Interval& value) {
+  if (value.IsEmpty() || value.hi < 0) {
+    return Interval::Empty();
+  }
+
+  if (value.IsPoint()) {
+    return PointResult(std::sqrt(value.lo));
+  }
+
+  Interval result = Increasing(
+      value, std::max(value.lo, 0.0), value.hi,
+      [](double v) { return std::sqrt(v); }, value.lo >= 0);
+  result.lo = std::max(result.lo, 0.0);
+  return result;
+}
+
+/**
+ * @brief Натуральный логарифм интервала. В нуле логарифм обращается в
+ * бесконечность, которая на графике не отображается, поэтому ноль считается
+ * вне области определения.
+ */
+Interval log(const Interval& value) {
+  if (value.IsEmpty() || value.hi <= 0) {
+    return Interval::Empty();
+  }
+
+  if (value.IsPoint()) {
+    return PointResult(std::log(value.lo));
+  }
+
+  return Increasing(
+      value, std::max(value.lo, 0.0), value.hi,
+      [](double v) { return std::log(v); }, value.lo > 0);
+}
+
+Interval log10(const Interval& value) {
+  if (value.IsEmpty() || value.hi <= 0) {
+    return Interval::Empty();
+  }
+
+  if (value.IsPoint()) {
+    return PointResult(std::log10(value.lo));
+  }
+
+  return Increasing(
+      value, std::max(value.lo, 0.0), value.hi,
+      [](double v) { return std::log10(v); }, value.lo > 0);
+}
+
+/**
+ * @brief Факториал интервала.
+ *
+ * Факториал постоянен на каждом отрезке [n, n + 1) и непрерывен только
+ * внутри одного такого отрезка. Значения таблицы факториалов монотонны до 20!,
+ * дальше результат не ограничивается.
+ */
+Interval Factorial(const Interval& value) {
+  if (value.IsEmpty() || value.hi < 0) {
+    return Interval::Empty();
+  }
+
+  if (value.IsPoint()) {
+    return PointResult(mathHelper::Factorial(value.lo));
+  }
+
+  double lo = std::max(value.lo, 0.0);
+  bool defined = value.defined && value.lo >= 0;
+
+  if (value.hi >= 21) {
+    return {0, kInf, defined, false};
+  }
+
+  bool continuous =
+      value.continuous && std::floor(lo) == std::floor(value.hi);
+  return {mathHelper::Factorial(lo), mathHelper::Factorial(value.hi), defined,
+          continuous && defined};
+}
+
+}  // namespace s21
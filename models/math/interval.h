@@ -0,0 +1,53 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALCV2_INTERVAL_H
+#define SMARTCALCV2_INTERVAL_H
+
+namespace s21 {
+
+// Интервал [lo, hi], гарантированно содержащий значения функции на отрезке
+// аргумента. Флаги описывают функцию на всем отрезке: defined - определена
+// в каждой точке, continuous - определена и непрерывна. Пустой интервал
+// (lo и hi равны NaN) означает, что функция нигде на отрезке не определена.
+struct Interval final {
+  Interval() = default;
+  Interval(double value);  // NOLINT(google-explicit-constructor)
+  Interval(double lo, double hi, bool defined = true, bool continuous = true);
+
+  static Interval Empty();
+  static Interval Entire(bool defined = false);
+
+  [[nodiscard]] bool IsEmpty() const noexcept;
+  [[nodiscard]] bool Contains(double value) const noexcept;
+  [[nodiscard]] bool IsPoint() const noexcept { return lo == hi; }
+
+  double lo = 0;
+  double hi = 0;
+  bool defined = true;
+  bool continuous = true;
+};
+
+Interval operator-(const Interval& value);
+Interval operator+(const Interval& lhs, const Interval& rhs);
+Interval operator-(const Interval& lhs, const Interval& rhs);
+Interval operator*(const Interval& lhs, const Interval& rhs);
+Interval operator/(const Interval& lhs, const Interval& rhs);
+
+Interval pow(const Interval& base, const Interval& exponent);
+Interval fmod(const Interval& lhs, const Interval& rhs);
+Interval sin(const Interval& value);
+Interval cos(const Interval& value);
+Interval tan(const Interval& value);
+Interval asin(const Interval& value);
+Interval acos(const Interval& value);
+Interval atan(const Interval& value);
+Interval sqrt(const Interval& value);
+Interval log(const Interval& value);
+Interval log10(const Interval& value);
+Interval Factorial(const Interval& value);
+
+}  // namespace s21
+
+#endif  // SMARTCALCV2_INTERVAL_H
@@ -0,0 +1,206 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#include "jet.h"
+
+#include <cmath>
+
+#include "../../helpers/mathHelper.h"
+
+namespace s21 {
+
+namespace {
+
+/**
+ * @brief Применяет функцию g к аргументу по правилу дифференцирования
+ * сложной функции: (g(u))' = g'(u) u', (g(u))'' = g''(u) u'^2 + g'(u) u''.
+ *
+ * Если аргумент не зависит от переменной, производные равны нулю, даже если
+ * производная g в этой точке бесконечна.
+ *
+ * @param u Аргумент.
+ * @param g Значение g(u).
+ * @param g1 Значение g'(u).
+ * @param g2 Значение g''(u).
+ * @return Значение и производные g(u).
+ */
+Jet Chain(const Jet& u, double g, double g1, double g2) {
+  if (u.d1 == 0 && u.d2 == 0) {
+    return Jet(g);
+  }
+
+  return {g, g1 * u.d1, g2 * u.d1 * u.d1 + g1 * u.d2};
+}
+
+/**
+ * @brief Проверяет, что значение не зависит от переменной.
+ */
+bool IsConstant(const Jet& value) { return value.d1 == 0 && value.d2 == 0; }
+
+}  // namespace
+
+/**
+ * @brief Создает постоянное значение с нулевыми производными.
+ * @param value Значение.
+ */
+Jet::Jet(double value) : value(value) {}
+
+/**
+ * @brief Создает значение с заданными производными.
+ * @param value Значение.
+ * @param d1 Первая производная.
+ * @param d2 Вторая производная.
+ */
+Jet::Jet(double value, double d1, double d2) : value(value), d1(d1), d2(d2) {}
+
+/**
+ * @brief Значение переменной дифференцирования: производная равна 1.
+ * @param value Значение переменной.
+ */
+Jet Jet::Variable(double value) { return {value, 1, 0}; }
+
+Jet operator-(const Jet& value) { return {-value.value, -value.d1, -value.d2}; }
+
+Jet operator+(const Jet& lhs, const Jet& rhs) {
+  return {lhs.value + rhs.value, lhs.d1 + rhs.d1, lhs.d2 + rhs.d2};
+}
+
+Jet operator-(const Jet& lhs, const Jet& rhs) {
+  return {lhs.value - rhs.value, lhs.d1 - rhs.d1, lhs.d2 - rhs.d2};
+}
+
+Jet operator*(const Jet& lhs, const Jet& rhs) {
+  return {lhs.value * rhs.value, lhs.d1 * rhs.value + lhs.value * rhs.d1,
+          lhs.d2 * rhs.value + 2 * lhs.d1 * rhs.d1 + lhs.value * rhs.d2};
+}
+
+/**
+ * @brief Частное w = u / v: w' = (u' - w v') / v, w'' = (u'' - 2 w' v' -
+ * w v'') / v.
+ */
+Jet operator/(const Jet& lhs, const Jet& rhs) {
+  double value = lhs.value / rhs.value;
+
+  if (IsConstant(lhs) && IsConstant(rhs)) {
+    return Jet(value);
+  }
+
+  double d1 = (lhs.d1 - value * rhs.d1) / rhs.value;
+  double d2 = (lhs.d2 - 2 * d1 * rhs.d1 - value * rhs.d2) / rhs.value;
+  return {value, d1, d2};
+}
+
+/**
+ * @brief Возведение в степень.
+ *
+ * При постоянном показателе степень дифференцируется как u^n, поэтому
+ * отрицательное основание с целым показателем допустимо. Иначе используется
+ * представление u^v = exp(v ln u).
+ */
+Jet pow(const Jet& base, const Jet& exponent) {
+  double value = std::pow(base.value, exponent.value);
+
+  if (IsConstant(exponent)) {
+    double n = exponent.value;
+
+    if (n == 0) {
+      return Jet(value);
+    }
+
+    return Chain(base, value, n * std::pow(base.value, n - 1),
+                 n * (n - 1) * std::pow(base.value, n - 2));
+  }
+
+  Jet power = exponent * log(base);
+  return {value, value * power.d1,
+          value * (power.d2 + power.d1 * power.d1)};
+}
+
+/**
+ * @brief Остаток от деления u - trunc(u / v) v. Частное между скачками
+ * постоянно, поэтому дифференцируется только линейная часть.
+ */
+Jet fmod(const Jet& lhs, const Jet& rhs) {
+  double value = std::fmod(lhs.value, rhs.value);
+  double quotient = std::trunc(lhs.value / rhs.value);
+  return {value, lhs.d1 - quotient * rhs.d1, lhs.d2 - quotient * rhs.d2};
+}
+
+Jet sin(const Jet& value) {
+  double s = std::sin(value.value);
+  return Chain(value, s, std::cos(value.value), -s);
+}
+
+Jet cos(const Jet& value) {
+  double c = std::cos(value.value);
+  return Chain(value, c, -std::sin(value.value), -c);
+}
+
+/**
+ * @brief Тангенс: tan' = 1 + tan^2, tan'' = 2 tan (1 + tan^2).
+ */
+Jet tan(const Jet& value) {
+  double t = std::tan(value.value);
+  double secant2 = 1 + t * t;
+  return Chain(value, t, secant2, 2 * t * secant2);
+}
+
+/**
+ * @brief Арксинус: asin' = 1 / sqrt(1 - u^2), asin'' = u / (1 - u^2)^(3/2).
+ */
+Jet asin(const Jet& value) {
+  double u = value.value;
+  double rest = 1 - u * u;
+  double d1 = 1 / std::sqrt(rest);
+  return Chain(value, std::asin(u), d1, u * d1 / rest);
+}
+
+/**
+ * @brief Арккосинус: acos = pi / 2 - asin, производные противоположны.
+ */
+Jet acos(const Jet& value) {
+  double u = value.value;
+  double rest = 1 - u * u;
+  double d1 = 1 / std::sqrt(rest);
+  return Chain(value, std::acos(u), -d1, -u * d1 / rest);
+}
+
+/**
+ * @brief Арктангенс: atan' = 1 / (1 + u^2), atan'' = -2u / (1 + u^2)^2.
+ */
+Jet atan(const Jet& value) {
+  double u = value.value;
+  double d1 = 1 / (1 + u * u);
+  return Chain(value, std::atan(u), d1, -2 * u * d1 * d1);
+}
+
+/**
+ * @brief Квадратный корень: sqrt' = 1 / (2 sqrt u), sqrt'' = -sqrt' / (2u).
+ */
+Jet sqrt(const Jet& value) {
+  double root = std::sqrt(value.value);
+  double d1 = 1 / (2 * root);
+  return Chain(value, root, d1, -d1 / (2 * value.value));
+}
+
+Jet log(const Jet& value) {
+  double inverse = 1 / value.value;
+  return Chain(value, std::log(value.value), inverse, -inverse * inverse);
+}
+
+Jet log10(const Jet& value) {
+  double inverse = 1 / (value.value * std::log(10.0));
+  return Chain(value, std::log10(value.value), inverse,
+               -inverse / value.value);
+}
+
+/**
+ * @brief Факториал целой части аргумента. Между целыми значениями функция
+ * постоянна, поэтому производные равны нулю.
+ */
+Jet Factorial(const Jet& value) {
+  return Jet(mathHelper::Factorial(value.value));
+}
+
+}  // namespace s21
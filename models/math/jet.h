@@ -0,0 +1,47 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALCV2_JET_H
+#define SMARTCALCV2_JET_H
+
+namespace s21 {
+
+// Значение функции вместе с первой и второй производными по переменной
+// (прямой режим автоматического дифференцирования). Операции над Jet
+// применяют правила дифференцирования сложной функции, поэтому программа
+// выражения, вычисленная над Jet, дает f, f' и f'' за один проход.
+struct Jet final {
+  Jet() = default;
+  Jet(double value);  // NOLINT(google-explicit-constructor)
+  Jet(double value, double d1, double d2);
+
+  static Jet Variable(double value);
+
+  double value = 0;
+  double d1 = 0;
+  double d2 = 0;
+};
+
+Jet operator-(const Jet& value);
+Jet operator+(const Jet& lhs, const Jet& rhs);
+Jet operator-(const Jet& lhs, const Jet& rhs);
+Jet operator*(const Jet& lhs, const Jet& rhs);
+Jet operator/(const Jet& lhs, const Jet& rhs);
+
+Jet pow(const Jet& base, const Jet& exponent);
+Jet fmod(const Jet& lhs, const Jet& rhs);
+Jet sin(const Jet& value);
+Jet cos(const Jet& value);
+Jet tan(const Jet& value);
+Jet asin(const Jet& value);
+Jet acos(const Jet& value);
+Jet atan(const Jet& value);
+Jet sqrt(const Jet& value);
+Jet log(const Jet& value);
+Jet log10(const Jet& value);
+Jet Factorial(const Jet& value);
+
+}  // namespace s21
+
+#endif  // SMARTCALCV2_JET_H
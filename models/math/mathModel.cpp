@@ -25,12 +25,19 @@ MathModel::MathModel() : MathModel("") {}
 MathModel::MathModel(std::string str)
     : needInit(true),
       isCalc(false),
+      isIntegrated(false),
       x(0.0),
       expression(std::move(str)),
       rpnExpression(""),
       tokensList({}),
       mathResult(std::numeric_limits<double>::quiet_NaN()),
-      radDegFactor(1) {};
+      radDegFactor(1),
+      solveBegin(-10),
+      solveEnd(10),
+      program(),
+      registers(),
+      roots(),
+      integral() {};
 
 /**
  * \brief Устанавливает новое математическое выражение.
@@ -41,6 +48,8 @@ void MathModel::setExpression(const std::string& newExpression) {
     expression = newExpression;
     needInit = true;
     isCalc = false;
+    roots.clear();
+    isIntegrated = false;
   }
 }
 
@@ -119,12 +128,42 @@ void MathModel::Calculate() {
   mathResult = CalcX(x);
 }
 
+/**
+ * \brief Находит все корни уравнения f(x) = 0 на отрезке [solveBegin,
+ * solveEnd], где f - текущее выражение.
+ * \throw WrongSolveRangeException если отрезок задан некорректно.
+ * \throw InputIncorrectException если выражение некорректно или зависит от
+ * параметров.
+ */
+void MathModel::Solve() {
+  roots.clear();
+  isIntegrated = false;
+  EquationSolver solver(getProgram());
+  roots = solver.Solve(solveBegin, solveEnd);
+}
+
+/**
+ * \brief Вычисляет определенный интеграл текущего выражения от solveBegin
+ * до solveEnd.
+ * \throw WrongIntegralRangeException если пределы не конечны.
+ * \throw InputIncorrectException если выражение некорректно или зависит от
+ * параметров.
+ */
+void MathModel::Integrate() {
+  roots.clear();
+  isIntegrated = false;
+  Integrator integrator(getProgram());
+  integral = integrator.Integrate(solveBegin, solveEnd);
+  isIntegrated = true;
+}
+
 /**
  * \brief Инициализирует математическую модель перед началом вычислений.
  */
 void MathModel::InitMathModel() {
   CalcRpn();
   InitCalcMachine();
+  program.Compile(tokensList);
   needInit = false;
 }
 
@@ -274,171 +313,43 @@ void MathModel::ResetModelResults() noexcept {
 /**
  * @brief Выполняет вычисление выражения для конкретного значения переменной x.
  *
+ * Выражение вычисляется скомпилированной программой, поэтому на каждую точку
+ * не разбирается список токенов.
+ *
  * @param xValue Значение переменной x, для которого вычисляется выражение.
  * @return Результат вычисления выражения.
  * @throw InputIncorrectException Если происходит ошибка в процессе вычисления
- * выражения.
+ * выражения или выражение содержит параметры или переменную y, значения
+ * которых не заданы.
  */
 double MathModel::CalcX(double xValue) {
   if (needInit) {
     InitMathModel();
   }
 
-  double res = 0.0;
-  std::stack<Token> tokenStack;
-  auto tokenBegin = tokensList.begin();
-  auto tokenEnd = tokensList.end();
-
-  for (; tokenBegin != tokenEnd; ++tokenBegin) {
-    Token check = *tokenBegin;
-
-    if (check.type == numberToken) {
-      tokenStack.push(check);
-    } else if (check.type == xToken) {
-      tokenStack.push(Token::MakeToken(numberToken, xValue));
-    } else if (check.IsConst()) {
-      tokenStack.push(Token::MakeToken(numberToken, check.value));
-    } else if (check.IsUnary()) {
-      if (!tokenStack.empty()) {
-        Token lastToken = tokenStack.top();
-        tokenStack.pop();
-        double _res = CalcUnaryOp(lastToken.value, check.type);
-        tokenStack.push(Token::MakeToken(numberToken, _res));
-      } else {
-        throw InputIncorrectException("Calculate error");
-      }
-    } else if (check.IsBinary()) {
-      if (!tokenStack.empty()) {
-        Token right = tokenStack.top();
-        tokenStack.pop();
-        if (!tokenStack.empty()) {
-          Token left = tokenStack.top();
-          tokenStack.pop();
-          double _res = CalcBinaryOp(left.value, right.value, check.type);
-          tokenStack.push(Token::MakeToken(numberToken, _res));
-        } else {
-          throw InputIncorrectException("Calculate error");
-        }
-      } else {
-        throw InputIncorrectException("Calculate error");
-      }
-    } else {
-      throw InputIncorrectException("Calculate error");
-    }
-  }
-
-  if (tokenStack.empty()) {
-    throw InputIncorrectException("Calculate error");
-  }
-
-  Token lastToken = tokenStack.top();
-  tokenStack.pop();
-
-  if (!tokenStack.empty()) {
-    throw InputIncorrectException("Calculate error");
-  } else {
-    res = lastToken.value;
+  if (program.HasParameters() || program.UsesY()) {
+    throw InputIncorrectException("Parameter value is not set");
   }
 
+  double res = program.Evaluate(xValue, registers);
   isCalc = true;
   return res;
 }
 
 /**
- * @brief Выполняет унарную операцию над значением.
+ * @brief Возвращает скомпилированную программу текущего выражения.
  *
- * @param value Значение, над которым выполняется операция.
- * @param type Тип унарной операции.
- * @return Результат унарной операции.
- */
-double MathModel::CalcUnaryOp(double value, TokenType type) const noexcept {
-  double result = 0.0;
-
-  switch (type) {
-    case unMinusToken:
-      result = 0 - value;
-      break;
-    case cosToken:
-      result = std::cos(value * radDegFactor);
-      break;
-    case sinToken:
-      result = std::sin(value * radDegFactor);
-      break;
-    case tanToken:
-      result = std::tan(value * radDegFactor);
-      break;
-    case acosToken:
-      result = std::acos(value);
-      break;
-    case asinToken:
-      result = std::asin(value);
-      break;
-    case atanToken:
-      result = std::atan(value);
-      break;
-    case sqrtToken:
-      result = std::sqrt(value);
-      break;
-    case lnToken:
-      result = std::log(value);
-      break;
-    case logToken:
-      result = std::log10(value);
-      break;
-    case factorialToken:
-      result = MathModel::factorial(value);
-      break;
-    default:
-      break;
-  }
-
-  return result;
-}
-
-
-/**
- * @brief Выполняет бинарную операцию над двумя значениями.
+ * Если выражение изменилось, оно разбирается и компилируется заново.
  *
- * @param value1 Первое значение.
- * @param value2 Второе значение.
- * @param type Тип бинарной операции.
- * @return Результат бинарной операции.
+ * @return Программа для вычисления выражения.
+ * @throw InputIncorrectException Если выражение некорректно.
  */
-double MathModel::CalcBinaryOp(double value1, double value2,
-                               TokenType type) noexcept {
-  double result = 0.0;
-
-  switch (type) {
-    case addToken:
-      result = value1 + value2;
-      break;
-    case subToken:
-      result = value1 - value2;
-      break;
-    case divToken:
-      result = value1 / value2;
-      break;
-    case mulToken:
-      result = value1 * value2;
-      break;
-    case powToken:
-      result = std::pow(value1, value2);
-      break;
-    case modToken:
-      result = std::fmod(value1, value2);
-      break;
-    default:
-      break;
+const ExpressionProgram& MathModel::getProgram() {
+  if (needInit) {
+    InitMathModel();
   }
 
-  return result;
+  return program;
 }
 
-double MathModel::factorial(double value) {
-  constexpr auto table = Table<66>();
-  assert(value >= 0);
-  return value < 66 ? static_cast<double>(table.t[static_cast<int>(value)]) : 0;
-}
-
-
 }  // namespace s21
\ No newline at end of file
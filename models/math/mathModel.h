@@ -7,10 +7,12 @@
 #include <list>
 #include <stack>
 #include <string>
-#include <cassert>
-#include <cstdint>
+#include <vector>
 
 #include "../calcException.h"
+#include "equationSolver.h"
+#include "integrator.h"
+#include "expressionProgram.h"
 #include "tokenHandle.h"
 
 namespace s21 {
@@ -31,7 +33,12 @@ class MathModel final {
 
   void setExpression(const std::string& newExpression);
   void setX(double newX) { this->x = newX; };
-  void setRadDegFactor(double radDegFactor) { this->radDegFactor = radDegFactor; };
+  void setSolveBegin(double newA) noexcept { solveBegin = newA; };
+  void setSolveEnd(double newB) noexcept { solveEnd = newB; };
+  void setRadDegFactor(double radDegFactor) {
+    this->radDegFactor = radDegFactor;
+    program.setRadDegFactor(radDegFactor);
+  };
   void ExpressionAddString(const std::string& str);
   void ExpressionDeleteEnd();
 
@@ -40,8 +47,20 @@ class MathModel final {
   [[nodiscard]] double getX_Value() const noexcept { return x; };
   [[nodiscard]] double getResult() const noexcept { return mathResult; };
   [[nodiscard]] bool getIsCalc() const noexcept { return isCalc; };
+  [[nodiscard]] double getSolveBegin() const noexcept { return solveBegin; };
+  [[nodiscard]] double getSolveEnd() const noexcept { return solveEnd; };
+  [[nodiscard]] const std::vector<EquationRoot>& getRoots() const noexcept {
+    return roots;
+  };
+  [[nodiscard]] bool getIsIntegrated() const noexcept { return isIntegrated; };
+  [[nodiscard]] const IntegralResult& getIntegral() const noexcept {
+    return integral;
+  };
+  const ExpressionProgram& getProgram();
 
   void Calculate();
+  void Solve();
+  void Integrate();
 
  private:
   void InitMathModel();
@@ -49,32 +68,23 @@ class MathModel final {
   void InitCalcMachine();
   void ResetModelResults() noexcept;
   double CalcX(double x = 0);
-  [[nodiscard]] double CalcUnaryOp(double value, TokenType type) const noexcept;
-  [[nodiscard]] static double CalcBinaryOp(double value1, double value2,
-                      TokenType type) noexcept;
   static void AppendStrWithPopStack(std::string& res, std::stack<Token>& stack,
                                     std::string& str);
   bool needInit;
   bool isCalc;
+  bool isIntegrated;
   double x;
   std::string expression;
   std::string rpnExpression;
   std::list<Token> tokensList;
   double mathResult;
   double radDegFactor;
-
-
-  static double factorial(double value) ;
-};
-
-template<int N>
-struct Table {
-  constexpr Table() : t() {
-    t[0] = 1;
-    for (auto i = 1; i < N; ++i)
-      t[i] = t[i - 1] * i;
-  }
-  std::uint64_t t[N];
+  double solveBegin;
+  double solveEnd;
+  ExpressionProgram program;
+  std::vector<double> registers;
+  std::vector<EquationRoot> roots;
+  IntegralResult integral;
 };
 
 }  // namespace s21
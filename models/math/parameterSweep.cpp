@@ -0,0 +1,142 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#include "parameterSweep.h"
+
+#include <algorithm>
+
+#include "../../helpers/parallelHelper.h"
+#include "../calcException.h"
+#include "mathModel.h"
+
+namespace s21 {
+
+/**
+ * @brief Возвращает значение параметра в узле сетки.
+ *
+ * @param index Номер узла от 0 до count - 1.
+ * @return Значение параметра, для одного узла - начало диапазона.
+ * @note Этот метод не выбрасывает исключений (noexcept).
+ */
+double SweepAxis::At(std::size_t index) const noexcept {
+  if (count <= 1) {
+    return begin;
+  }
+
+  return begin + (end - begin) * static_cast<double>(index) /
+                     static_cast<double>(count - 1);
+}
+
+/**
+ * @brief Конструктор класса ParameterSweep.
+ *
+ * Выражение разбирается и компилируется один раз, дальше программа
+ * вычисляется во всех узлах сетки без повторного разбора.
+ *
+ * @param expression Выражение от x и параметров, например `a*sin(b*x)`.
+ * @throw InputZeroLengthException если выражение пустое.
+ * @throw InputIncorrectException если выражение некорректно.
+ */
+ParameterSweep::ParameterSweep(const std::string& expression) : program() {
+  MathModel mathModel(expression);
+  program.Append(mathModel.getProgram());
+}
+
+/**
+ * @brief Вычисляет выражение на сетке значений x и параметров.
+ *
+ * Строки матрицы перебирают все сочетания узлов осей параметров, быстрее
+ * всего меняется последняя ось. Ячейки матрицы делятся на блоки, которые
+ * вычисляются параллельно, у каждого блока свой буфер регистров.
+ *
+ * @param xs Значения x, столбцы матрицы.
+ * @param axes Сетки значений параметров.
+ * @param threads Количество потоков, 0 - по числу ядер.
+ * @return Матрица значений выражения.
+ * @throw InputIncorrectException если оси заданы некорректно или значение
+ * одного из параметров выражения не задано.
+ */
+SweepResult ParameterSweep::Calculate(const std::vector<double>& xs,
+                                      const std::vector<SweepAxis>& axes,
+                                      unsigned threads) const {
+  CheckAxes(axes);
+
+  SweepResult result;
+  result.rows = 1;
+  result.columns = xs.size();
+
+  for (const SweepAxis& axis : axes) {
+    result.rows *= axis.count;
+  }
+
+  result.values.resize(result.rows * result.columns);
+
+  parallelHelper::ParallelFor(
+      result.values.size(), blockSize,
+      [&](std::size_t begin, std::size_t end) {
+        std::vector<double> registers;
+        std::size_t row = begin / result.columns;
+        ExpressionProgram::Parameters parameters = RowParameters(axes, row);
+
+        for (std::size_t cell = begin; cell < end; ++cell) {
+          if (cell / result.columns != row) {
+            row = cell / result.columns;
+            parameters = RowParameters(axes, row);
+          }
+
+          program.Run(xs[cell % result.columns], parameters, registers);
+          result.values[cell] = program.Output(0, registers);
+        }
+      },
+      threads);
+
+  return result;
+}
+
+/**
+ * @brief Возвращает значения параметров для строки матрицы результата.
+ *
+ * @param axes Сетки значений параметров.
+ * @param row Номер строки.
+ * @return Значения параметров, не заданные осями параметры равны NaN.
+ */
+ExpressionProgram::Parameters ParameterSweep::RowParameters(
+    const std::vector<SweepAxis>& axes, std::size_t row) {
+  ExpressionProgram::Parameters parameters = ExpressionProgram::NoParameters();
+
+  for (auto axis = axes.rbegin(); axis != axes.rend(); ++axis) {
+    parameters[axis->name - 'a'] = axis->At(row % axis->count);
+    row /= axis->count;
+  }
+
+  return parameters;
+}
+
+/**
+ * @brief Проверяет оси параметров.
+ *
+ * @param axes Сетки значений параметров.
+ * @throw InputIncorrectException если имя оси не латинская буква, оси
+ * повторяются, в оси нет узлов или у параметра выражения нет оси.
+ */
+void ParameterSweep::CheckAxes(const std::vector<SweepAxis>& axes) const {
+  std::string names;
+
+  for (const SweepAxis& axis : axes) {
+    if (axis.name < 'a' || axis.name > 'z' || axis.count == 0 ||
+        names.find(axis.name) != std::string::npos) {
+      throw InputIncorrectException("Incorrect parameter axis");
+    }
+
+    names.push_back(axis.name);
+  }
+
+  for (char name : program.getParameterNames()) {
+    if (names.find(name) == std::string::npos) {
+      throw InputIncorrectException("Parameter value is not set");
+    }
+  }
+}
+
+}  // namespace s21
@@ -0,0 +1,68 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALCV2_PARAMETERSWEEP_H
+#define SMARTCALCV2_PARAMETERSWEEP_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "expressionProgram.h"
+
+namespace s21 {
+
+// Равномерная сетка значений одного параметра
+struct SweepAxis final {
+  char name = 'a';
+  double begin = 0;
+  double end = 0;
+  std::size_t count = 1;
+
+  [[nodiscard]] double At(std::size_t index) const noexcept;
+};
+
+// Плотная матрица результатов: строка - набор значений параметров, столбец -
+// значение x. Значения хранятся по строкам.
+struct SweepResult final {
+  std::size_t rows = 0;
+  std::size_t columns = 0;
+  std::vector<double> values;
+
+  [[nodiscard]] double At(std::size_t row, std::size_t column) const noexcept {
+    return values[row * columns + column];
+  }
+};
+
+class ParameterSweep final {
+ public:
+  explicit ParameterSweep(const std::string& expression);
+
+  ParameterSweep(const ParameterSweep& other) = delete;
+  ParameterSweep(ParameterSweep&& other) = delete;
+  ParameterSweep& operator=(const ParameterSweep& other) = delete;
+  ParameterSweep& operator=(ParameterSweep&& other) = delete;
+  ~ParameterSweep() = default;
+
+  [[nodiscard]] std::string getParameterNames() const {
+    return program.getParameterNames();
+  }
+
+  [[nodiscard]] SweepResult Calculate(const std::vector<double>& xs,
+                                      const std::vector<SweepAxis>& axes,
+                                      unsigned threads = 0) const;
+  [[nodiscard]] static ExpressionProgram::Parameters RowParameters(
+      const std::vector<SweepAxis>& axes, std::size_t row);
+
+ private:
+  const std::size_t blockSize = 4096;
+
+  void CheckAxes(const std::vector<SweepAxis>& axes) const;
+
+  ExpressionProgram program;
+};
+
+}  // namespace s21
+
+#endif  // SMARTCALCV2_PARAMETERSWEEP_H
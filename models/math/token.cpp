@@ -103,12 +103,16 @@ Token Token::MakeToken(TokenType type, double value,
       return Token{logToken, "log", 0, true};
     case xToken:
       return Token{xToken, "x", 0, true};
+    case yToken:
+      return Token{yToken, "y", 0, true};
     case piToken:
       return Token{piToken, "pi", 0, true, Token::PI};
     case eToken:
       return Token{eToken, "e", 0, true, Token::E};
     case factorialToken:
     return Token{factorialToken, "!", 3, true};
+    case paramToken:
+      return Token{paramToken, string, 0, true, value};
     case unknownToken:
     default:
       return Token{unknownToken, "", 0, false};
@@ -121,7 +125,7 @@ Token Token::MakeToken(TokenType type, double value,
  */
 bool Token::IsConst() const noexcept {
   return type == numberToken || type == xToken || type == eToken ||
-         type == piToken;
+         type == piToken || type == paramToken || type == yToken;
 }
 
 /**
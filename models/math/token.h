@@ -35,6 +35,8 @@ enum TokenType {
   piToken,        // Математическая константа Пи
   eToken,         // Математическая константа Е
   factorialToken,  // !
+  paramToken,     // Параметр выражения - латинская буква, не занятая функцией
+  yToken,         // y
 };
 
 struct Token final {
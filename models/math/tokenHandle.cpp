@@ -336,6 +336,8 @@ std::string tokenHandle::ListToStr(const std::list<Token>& list) {
  * Она ищет совпадение начала строки с ключами в таблице соответствия типов
  * токенов. Если найдено совпадение, функция создает токен соответствующего типа
  * и возвращает его вместе с оставшейся частью строки после извлечения токена.
+ * Латинская буква, с которой не начинается ни одна функция или константа,
+ * становится параметром выражения, его значение - номер буквы в алфавите.
  * Если совпадение не найдено, функция возвращает пустой токен и оставшуюся
  * часть входной строки.
  */
@@ -353,6 +355,12 @@ std::pair<Token, std::string_view> tokenHandle::GetNoNumTokenFromStr(
     }
   }
 
+  if (!str.empty() && str.front() >= 'a' && str.front() <= 'z') {
+    newView.remove_prefix(1);
+    token = Token::MakeToken(paramToken, str.front() - 'a',
+                             std::string(1, str.front()));
+  }
+
   return {token, newView};
 }
 
@@ -0,0 +1,160 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALC_MONEY_H
+#define SMARTCALC_MONEY_H
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include "financeException.h"
+
+namespace s21 {
+
+// Денежная сумма с фиксированной точкой: целое число копеек. Сложение и
+// сравнение точные, округление выполняется только при переводе из double.
+// 64 бит хватает на ±9.2E16 рублей, на порядки больше допустимых сумм
+// кредитов и вкладов. Сумма вне этих пределов не создается: перевод из
+// double и арифметика бросают FinanceOverflowException
+class Money final {
+ public:
+  enum Rounding {
+    HalfAwayFromZero,  // Половина копейки - от нуля, как std::round
+    HalfToEven,        // Половина копейки - к четной, банковское округление
+    TowardZero,        // Отбрасывание долей копейки
+    Floor,             // Вниз
+    Ceiling,           // Вверх
+  };
+
+  static constexpr std::int64_t kopecksInRuble = 100;
+  // Суммы лежат в [-maxKopecks, maxKopecks], поэтому смена знака не
+  // переполняется
+  static constexpr std::int64_t maxKopecks =
+      std::numeric_limits<std::int64_t>::max();
+  // 2^63 - первое число копеек, которое не помещается в std::int64_t
+  static constexpr double kopecksLimit = 9223372036854775808.0;
+
+  constexpr Money() noexcept : kopecks(0) {}
+
+  [[nodiscard]] static constexpr Money FromKopecks(
+      std::int64_t kopecks) noexcept {
+    return Money(kopecks);
+  }
+
+  /**
+   * @brief Округляет сумму в рублях до копеек.
+   *
+   * При округлении HalfAwayFromZero ToDouble() результата совпадает с
+   * `mathHelper::Round(rubles, 2)` до последнего бита, но без std::pow.
+   *
+   * @param rubles Сумма в рублях.
+   * @param rounding Способ округления долей копейки.
+   * @throw FinanceOverflowException если сумма бесконечна, не число или
+   * больше ±9.2E16 рублей.
+   */
+  [[nodiscard]] static Money FromDouble(
+      double rubles, Rounding rounding = HalfAwayFromZero) {
+    double scaled = rubles * kopecksInRuble;
+    double rounded;
+
+    if (rounding == HalfToEven) {
+      rounded = std::round(scaled);
+
+      if (std::abs(scaled - std::trunc(scaled)) == 0.5) {
+        rounded = 2 * std::round(scaled / 2);
+      }
+    } else if (rounding == TowardZero) {
+      rounded = std::trunc(scaled);
+    } else if (rounding == Floor) {
+      rounded = std::floor(scaled);
+    } else if (rounding == Ceiling) {
+      rounded = std::ceil(scaled);
+    } else {
+      rounded = std::round(scaled);
+    }
+
+    // Приведение числа вне диапазона к целому - неопределенное поведение
+    if (!(rounded > -kopecksLimit && rounded < kopecksLimit)) {
+      throw FinanceOverflowException("Money is out of range");
+    }
+
+    return Money(static_cast<std::int64_t>(rounded));
+  }
+
+  [[nodiscard]] constexpr std::int64_t Kopecks() const noexcept {
+    return kopecks;
+  }
+
+  [[nodiscard]] constexpr double ToDouble() const noexcept {
+    return static_cast<double>(kopecks) / kopecksInRuble;
+  }
+
+  constexpr Money& operator+=(Money other) {
+    if (other.kopecks > 0 ? kopecks > maxKopecks - other.kopecks
+                          : kopecks < -maxKopecks - other.kopecks) {
+      throw FinanceOverflowException("Money is out of range");
+    }
+
+    kopecks += other.kopecks;
+    return *this;
+  }
+
+  constexpr Money& operator-=(Money other) { return *this += -other; }
+
+  constexpr Money operator-() const noexcept { return Money(-kopecks); }
+
+  friend constexpr Money operator+(Money lhs, Money rhs) {
+    return lhs += rhs;
+  }
+
+  friend constexpr Money operator-(Money lhs, Money rhs) {
+    return lhs -= rhs;
+  }
+
+  friend constexpr Money operator*(Money lhs, std::int64_t count) {
+    std::int64_t size = lhs.kopecks < 0 ? -lhs.kopecks : lhs.kopecks;
+    std::int64_t limit = size == 0 ? maxKopecks : maxKopecks / size;
+
+    if (count > limit || count < -limit) {
+      throw FinanceOverflowException("Money is out of range");
+    }
+
+    return Money(lhs.kopecks * count);
+  }
+
+  friend constexpr bool operator==(Money lhs, Money rhs) noexcept {
+    return lhs.kopecks == rhs.kopecks;
+  }
+
+  friend constexpr bool operator!=(Money lhs, Money rhs) noexcept {
+    return lhs.kopecks != rhs.kopecks;
+  }
+
+  friend constexpr bool operator<(Money lhs, Money rhs) noexcept {
+    return lhs.kopecks < rhs.kopecks;
+  }
+
+  friend constexpr bool operator>(Money lhs, Money rhs) noexcept {
+    return lhs.kopecks > rhs.kopecks;
+  }
+
+  friend constexpr bool operator<=(Money lhs, Money rhs) noexcept {
+    return lhs.kopecks <= rhs.kopecks;
+  }
+
+  friend constexpr bool operator>=(Money lhs, Money rhs) noexcept {
+    return lhs.kopecks >= rhs.kopecks;
+  }
+
+ private:
+  explicit constexpr Money(std::int64_t newKopecks) noexcept
+      : kopecks(newKopecks) {}
+
+  std::int64_t kopecks;
+};
+
+}  // namespace s21
+
+#endif  // SMARTCALC_MONEY_H
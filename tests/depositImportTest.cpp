@@ -0,0 +1,139 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+// Проверяет разбор таблицы операций вклада DepositImport::Parse: BOM,
+// заголовок, оба формата даты, разделители столбцов, сумму с запятой и
+// номера ошибочных строк. Код возврата 0 - все проверки прошли.
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../models/deposit/DepositImport.h"
+#include "../models/financeException.h"
+
+namespace s21 {
+
+namespace {
+
+int failures = 0;
+
+void Report(const char* check, const std::string& details) {
+  ++failures;
+  std::fprintf(stderr, "%s: %s\n", check, details.c_str());
+}
+
+std::string Describe(const DepositOperation& operation) {
+  char buffer[64];
+  std::snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d %.2f", operation.year,
+                operation.month, operation.day, operation.amount);
+  return buffer;
+}
+
+// Таблица разбирается в точности в ожидаемые операции
+void ExpectOperations(const char* check, std::string_view text,
+                      const std::vector<DepositOperation>& expected) {
+  std::vector<DepositOperation> operations;
+
+  try {
+    operations = DepositImport::Parse(text);
+  } catch (const FinanceImportException& e) {
+    Report(check, "error in line " + std::to_string(e.getLine()));
+    return;
+  }
+
+  if (operations.size() != expected.size()) {
+    Report(check, std::to_string(operations.size()) +
+                      " operations instead of " +
+                      std::to_string(expected.size()));
+    return;
+  }
+
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    if (Describe(operations[i]) != Describe(expected[i])) {
+      Report(check,
+             Describe(operations[i]) + " instead of " + Describe(expected[i]));
+    }
+  }
+}
+
+// Разбор таблицы останавливается на строке line
+void ExpectError(const char* check, std::string_view text, std::size_t line) {
+  try {
+    DepositImport::Parse(text);
+    Report(check, "no error");
+  } catch (const FinanceImportException& e) {
+    if (e.getLine() != line) {
+      Report(check, "error in line " + std::to_string(e.getLine()) +
+                        " instead of " + std::to_string(line));
+    }
+  }
+}
+
+void CheckOperations() {
+  ExpectOperations("empty", "", {});
+  ExpectOperations("header only", "Дата,Сумма\r\n", {});
+  ExpectOperations("bom and header",
+                   "\xEF\xBB\xBFДата,Сумма\n2024-01-06,1000\n",
+                   {{2024, 1, 6, 1000}});
+  ExpectOperations("date formats",
+                   "2024-01-06,1000.5\n06.02.2024,-250\n\n29.02.2024,+0.01\n",
+                   {
+                       {2024, 1, 6, 1000.5},
+                       {2024, 2, 6, -250},
+                       {2024, 2, 29, 0.01},
+                   });
+  ExpectOperations("quoted decimal comma",
+                   "Дата,Сумма,Описание\n"
+                   "2024-01-06,\"1 000,50\",Пополнение\n"
+                   "2024-01-07,\"-20,5\",\"Снятие, наличные\"\n"
+                   "2024-01-08,\"300\",50\n",
+                   {
+                       {2024, 1, 6, 1000.5},
+                       {2024, 1, 7, -20.5},
+                       {2024, 1, 8, 300},
+                   });
+  ExpectOperations("other columns",
+                   "2024-01-06,1000,500\n2024-01-07,1000.25,50\n",
+                   {
+                       {2024, 1, 6, 1000},
+                       {2024, 1, 7, 1000.25},
+                   });
+  ExpectOperations("semicolon", "Дата;Сумма\r\n06.01.2024;1 000,50;50\r\n",
+                   {{2024, 1, 6, 1000.5}});
+  ExpectOperations("tab", "06.01.2024\t1000,5\n07.01.2024\t-7\tкомментарий\n",
+                   {
+                       {2024, 1, 6, 1000.5},
+                       {2024, 1, 7, -7},
+                   });
+}
+
+void CheckErrors() {
+  ExpectError("header with digits", "Выписка за 2024\n2024-01-06,1000\n", 1);
+  ExpectError("missing date", "Дата,Сумма\n2024-01-06,1000\n,5\n", 3);
+  ExpectError("nonexistent date", "Дата,Сумма\n\n2023-02-29,5\n", 3);
+  ExpectError("zero amount", "2024-01-06,1000\r\n2024-01-07,0.00\r\n", 2);
+  ExpectError("three decimals", "2024-01-06;1000,505\n", 1);
+  ExpectError("unquoted comma kopecks",
+              "Дата,Сумма\n2024-01-06,1000\n2024-01-07,1000,50\n", 3);
+  ExpectError("unquoted comma kopeck", "2024-01-06,1000,5\n", 1);
+}
+
+}  // namespace
+
+}  // namespace s21
+
+int main() {
+  s21::CheckOperations();
+  s21::CheckErrors();
+
+  if (s21::failures > 0) {
+    std::fprintf(stderr, "%d failed checks\n", s21::failures);
+    return 1;
+  }
+
+  std::printf("deposit import checks passed\n");
+  return 0;
+}
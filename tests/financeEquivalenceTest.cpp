@@ -0,0 +1,771 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+// Сравнивает быстрые расчеты кредитов и вкладов с простыми циклами на
+// случайных входных данных. Кредиты сравниваются с копиями исходных
+// помесячных циклов, сценарии с событиями - с помесячным циклом, подбор
+// параметров - с обратным расчетом. Вклады сравниваются с посуточным циклом
+// после перехода на Money, а не с исходным циклом на double с
+// mathHelper::Round: его копейки расходятся с Money. Генератор случайных
+// чисел инициализируется постоянным числом, поэтому проверка
+// воспроизводима. Код возврата 0 - все расчеты совпали.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../models/credit/creditBatch.h"
+#include "../models/credit/creditGoalSeek.h"
+#include "../models/credit/creditModel.h"
+#include "../models/credit/creditScenario.h"
+#include "../models/deposit/DepositModel.h"
+
+namespace s21 {
+
+namespace {
+
+// Выводится не больше стольких расхождений каждой проверки
+const int maxReports = 10;
+
+int failures = 0;
+
+void Report(const char* check, int index, const std::string& details) {
+  if (++failures <= maxReports) {
+    std::fprintf(stderr, "%s #%d: %s\n", check, index, details.c_str());
+  }
+}
+
+std::string Pair(double lhs, double rhs) {
+  char buffer[96];
+  std::snprintf(buffer, sizeof(buffer), "%.17g != %.17g", lhs, rhs);
+  return buffer;
+}
+
+// Копия mathHelper::Round до появления Money
+double BaselineRound(double value, int precision) {
+  double k = std::pow(10, precision);
+  return (std::round(value * k) / k);
+}
+
+// Копия mathHelper::GetDaysCount до появления Date
+int BaselineDaysCount(int month, int year) {
+  return 31 - (102 / month & 1) -
+         ((4 / month & 2) >> (!(year % 4) - !(year % 100) + !(year % 400)));
+}
+
+// Исходный расчет аннуитета в CreditModel::CalculateHandle
+CreditTotals BaselineAnnuity(double sum, int months, double interest) {
+  double monthInterest = interest / (100 * 12);
+  double monthPay =
+      sum * (monthInterest +
+             monthInterest / (std::pow(monthInterest + 1, months) - 1));
+  double totalPay = monthPay * months;
+  return {monthPay, monthPay, totalPay - sum, totalPay};
+}
+
+// Исходный помесячный цикл дифференцированного кредита. Без округления
+// платежи складываются тем же циклом. Округленные платежи складываются еще и
+// в копейках, как в Money: сумма double накапливает ошибку
+CreditTotals BaselineDifferentiated(double sum, int months, double interest,
+                                    bool round, Money* roundedTotal = nullptr) {
+  double monthPayMin =
+      sum + 2 * sum * (CreditModel::maxCreditInterest / (12 * 100));
+  double monthPayMax = 0;
+  double totalPay = 0;
+  double payMain = sum / months;
+  double monthInterest = interest / (100 * 12);
+  double tempSum = sum;
+
+  for (int i = 0; i < months; ++i) {
+    double payAdd = tempSum * monthInterest;
+    tempSum -= payMain;
+    double monthPay = payMain + payAdd;
+
+    if (round) {
+      monthPay = BaselineRound(monthPay, 2);
+    }
+
+    totalPay += monthPay;
+
+    if (roundedTotal) {
+      *roundedTotal += Money::FromDouble(monthPay);
+    }
+
+    monthPayMax = std::max(monthPayMax, monthPay);
+    monthPayMin = std::min(monthPayMin, monthPay);
+  }
+
+  return {monthPayMin, monthPayMax, totalPay - sum, totalPay};
+}
+
+struct DepositInput {
+  double sum;
+  int months;
+  double interest;
+  double tax;
+  DepositModel::PayPeriodDepositType payPeriod;
+  bool capitalization;
+  int year;
+  int month;
+  int day;
+  std::vector<DepositOperation> operations;
+};
+
+struct DepositOutput {
+  bool noMoney = false;
+  double interest = 0;
+  double deposit = 0;
+  double tax = 0;
+};
+
+// Посуточный цикл DepositModel::CalculateHandle после перехода на Money:
+// суммы копятся в копейках, операции ищутся перебором в каждый день срока
+DepositOutput BaselineDeposit(const DepositInput& input) {
+  DepositOutput output;
+  int startYear = input.year;
+  int startMonth = input.month;
+  int startDay = input.day;
+
+  Money totalInterestPayment;
+  double endInterestPayment = 0;
+  double totalInterestPaymentForTax = 0;
+  Money totalSum = Money::FromDouble(input.sum);
+  Money totalTax;
+
+  double pd = input.interest / (100 * 365);
+  double pdv = input.interest / (100 * 366);
+
+  auto operationsHandle = [&](int year, int month, int day) {
+    for (const DepositOperation& item : input.operations) {
+      if (year == item.year && month == item.month && day == item.day) {
+        totalSum += Money::FromDouble(item.amount);
+      }
+    }
+  };
+
+  int counter = input.months;
+
+  while (counter >= 0) {
+    int numDays = BaselineDaysCount(startMonth, startYear);
+    double dayRate = BaselineDaysCount(2, startYear) == 29 ? pdv : pd;
+    double monthSum = 0;
+    Money monthPayment;
+
+    for (int day = 1; day <= numDays; ++day) {
+      if (totalSum < Money()) {
+        output.noMoney = true;
+        return output;
+      }
+
+      if (counter == input.months && day <= startDay) {
+        if (day == startDay) {
+          operationsHandle(startYear, startMonth, day);
+        }
+
+        continue;
+      }
+
+      if (counter == 0 && day > startDay) {
+        continue;
+      }
+
+      double percentSum = dayRate * totalSum.ToDouble();
+
+      if (input.payPeriod == DepositModel::Day) {
+        Money dayPayment = Money::FromDouble(percentSum);
+        monthPayment += dayPayment;
+
+        if (input.capitalization) {
+          totalSum += dayPayment;
+        }
+      } else {
+        monthSum += percentSum;
+      }
+
+      operationsHandle(startYear, startMonth, day);
+    }
+
+    if (input.payPeriod == DepositModel::Month) {
+      monthPayment = Money::FromDouble(monthSum);
+
+      if (input.capitalization) {
+        totalSum += monthPayment;
+      }
+    }
+
+    if (input.payPeriod == DepositModel::End) {
+      endInterestPayment += monthSum;
+      totalInterestPaymentForTax += monthSum;
+    } else {
+      totalInterestPayment += monthPayment;
+      totalInterestPaymentForTax += monthPayment.ToDouble();
+    }
+
+    if (++startMonth == 13) {
+      startMonth = 1;
+      ++startYear;
+
+      if (totalInterestPaymentForTax > 160000) {
+        totalTax += Money::FromDouble(
+            (totalInterestPaymentForTax - 1000000 * 0.16) * (input.tax / 100));
+        totalInterestPaymentForTax = 0;
+      }
+    }
+
+    --counter;
+  }
+
+  if (input.payPeriod == DepositModel::End) {
+    totalInterestPayment = Money::FromDouble(endInterestPayment);
+
+    if (input.capitalization) {
+      totalSum += totalInterestPayment;
+    }
+  }
+
+  if (totalInterestPaymentForTax > 160000) {
+    totalTax += Money::FromDouble(
+        (totalInterestPaymentForTax - 1000000 * 0.16) * (input.tax / 100));
+  }
+
+  output.interest = totalInterestPayment.ToDouble();
+  output.deposit = totalSum.ToDouble();
+  output.tax = totalTax.ToDouble();
+  return output;
+}
+
+DepositOutput EngineDeposit(const DepositInput& input,
+                            DepositModel::InterestAccrual accrual) {
+  DepositModel model;
+  model.setSum(input.sum);
+  model.setMonths(input.months);
+  model.setInterest(input.interest);
+  model.setTax(input.tax);
+  model.setPayPeriod(input.payPeriod);
+  model.setCapitalization(input.capitalization);
+  model.setAccrual(accrual);
+  model.setStartDate(input.year, input.month, input.day);
+
+  for (const DepositOperation& operation : input.operations) {
+    model.AddOperation(operation.year, operation.month, operation.day,
+                       operation.amount);
+  }
+
+  DepositOutput output;
+
+  try {
+    model.CalculateDeposit();
+    output.interest = model.getInterestAmount();
+    output.deposit = model.getDepositAmount();
+    output.tax = model.getTaxAmount();
+  } catch (const FinanceOperationNoMoneyException&) {
+    output.noMoney = true;
+  }
+
+  return output;
+}
+
+/**
+ * @brief AnnuityTotals и DifferentiatedTotals против исходных циклов.
+ *
+ * Аннуитет и округленные платежи совпадают до последнего бита, общая выплата
+ * с округлением - с точной суммой округленных платежей, без округления -
+ * с точностью 1E-12.
+ */
+void CheckCreditTotals(std::mt19937_64& random) {
+  std::uniform_real_distribution<double> sums(0.01, 1E10);
+  std::uniform_real_distribution<double> interests(0.01, 999);
+  std::uniform_int_distribution<int> terms(1, 600);
+
+  for (int i = 0; i < 50000; ++i) {
+    double sum = std::round(sums(random) * 100) / 100;
+    double interest = std::round(interests(random) * 100) / 100;
+    int months = terms(random);
+
+    CreditTotals annuity = CreditModel::AnnuityTotals(sum, months, interest);
+    CreditTotals annuityBase = BaselineAnnuity(sum, months, interest);
+
+    if (annuity.paymentMin != annuityBase.paymentMin ||
+        annuity.totalPayment != annuityBase.totalPayment ||
+        annuity.overPayment != annuityBase.overPayment) {
+      Report("annuity", i,
+             Pair(annuity.totalPayment, annuityBase.totalPayment));
+    }
+
+    CreditTotals rounded = CreditModel::DifferentiatedTotals(
+        sum, months, interest, CreditModel::RoundToKopecks);
+    Money roundedTotal;
+    CreditTotals roundedBase =
+        BaselineDifferentiated(sum, months, interest, true, &roundedTotal);
+
+    if (rounded.paymentMin != roundedBase.paymentMin ||
+        rounded.paymentMax != roundedBase.paymentMax ||
+        rounded.totalPayment != roundedTotal.ToDouble() ||
+        rounded.overPayment != roundedTotal.ToDouble() - sum) {
+      Report("differentiated rounded", i,
+             Pair(rounded.totalPayment, roundedTotal.ToDouble()));
+    }
+
+    CreditTotals unrounded = CreditModel::DifferentiatedTotals(
+        sum, months, interest, CreditModel::Unrounded);
+    CreditTotals unroundedBase =
+        BaselineDifferentiated(sum, months, interest, false);
+    double tolerance = 1E-12 * unroundedBase.totalPayment;
+
+    if (std::abs(unrounded.totalPayment - unroundedBase.totalPayment) >
+            tolerance ||
+        std::abs(unrounded.paymentMin - unroundedBase.paymentMin) >
+            tolerance ||
+        std::abs(unrounded.paymentMax - unroundedBase.paymentMax) >
+            tolerance) {
+      Report("differentiated unrounded", i,
+             Pair(unrounded.totalPayment, unroundedBase.totalPayment));
+    }
+  }
+}
+
+/**
+ * @brief CreditBatch против CreditModel для каждого кредита портфеля, включая
+ * некорректные кредиты.
+ */
+void CheckCreditBatch(std::mt19937_64& random) {
+  std::uniform_real_distribution<double> sums(-1E3, 1.1E10);
+  std::uniform_real_distribution<double> interests(-10, 1100);
+  std::uniform_int_distribution<int> terms(-5, 650);
+  std::bernoulli_distribution annuity(0.5);
+
+  CreditBatchInput input;
+
+  for (int i = 0; i < 20000; ++i) {
+    input.sums.push_back(std::round(sums(random) * 100) / 100);
+    input.months.push_back(terms(random));
+    input.interests.push_back(std::round(interests(random) * 100) / 100);
+    input.types.push_back(annuity(random) ? CreditModel::Annuity
+                                          : CreditModel::Differentiated);
+  }
+
+  for (CreditModel::PaymentRounding rounding :
+       {CreditModel::RoundToKopecks, CreditModel::Unrounded}) {
+    CreditBatchResult result = CreditBatch::Calculate(input, rounding);
+    CreditModel model;
+    model.setRounding(rounding);
+
+    for (std::size_t i = 0; i < input.Size(); ++i) {
+      model.setSum(input.sums[i]);
+      model.setMonths(input.months[i]);
+      model.setInterest(input.interests[i]);
+      model.setType(input.types[i]);
+      CreditBatchResult::Status status = CreditBatchResult::Ok;
+
+      try {
+        model.CalculateCredit();
+      } catch (const FinanceSumException&) {
+        status = CreditBatchResult::WrongSum;
+      } catch (const FinanceMonthException&) {
+        status = CreditBatchResult::WrongMonths;
+      } catch (const FinanceInterestException&) {
+        status = CreditBatchResult::WrongInterest;
+      }
+
+      int index = static_cast<int>(i);
+
+      if (result.status[i] != status) {
+        Report("batch status", index, Pair(result.status[i], status));
+      } else if (status == CreditBatchResult::Ok &&
+                 (result.paymentMin[i] != model.getPaymentMin() ||
+                  result.paymentMax[i] != model.getPaymentMax() ||
+                  result.overPayment[i] != model.getOverPayment() ||
+                  result.totalPayment[i] != model.getTotalPayment())) {
+        Report("batch totals", index,
+               Pair(result.totalPayment[i], model.getTotalPayment()));
+      }
+    }
+  }
+}
+
+bool AnnuityFits(double sum, int months, double interest, double payment) {
+  return CreditModel::AnnuityTotals(sum, months, interest).paymentMin <=
+         payment;
+}
+
+/**
+ * @brief Подбор параметров аннуитета: ставка по платежу возвращает исходную
+ * ставку, подобранная сумма наибольшая, а срок наименьший из подходящих.
+ */
+void CheckGoalSeek(std::mt19937_64& random) {
+  std::uniform_real_distribution<double> sums(0.01, 1E10);
+  std::uniform_real_distribution<double> interests(0.01, 999);
+  std::uniform_int_distribution<int> terms(1, 600);
+  std::uniform_real_distribution<double> shifts(0.999, 1.001);
+
+  for (int i = 0; i < 200000; ++i) {
+    double sum = std::round(sums(random) * 100) / 100;
+    double interest = std::round(interests(random) * 100) / 100;
+    int months = terms(random);
+    double payment =
+        CreditModel::AnnuityTotals(sum, months, interest).paymentMin;
+
+    if (i % 4 == 0) {
+      double found = CreditGoalSeek::Interest(sum, months, payment);
+
+      if (std::abs(found - interest) > 1E-6 * interest) {
+        Report("goal seek interest", i, Pair(found, interest));
+      }
+    }
+
+    payment *= shifts(random);
+
+    try {
+      double found = CreditGoalSeek::Sum(payment, months, interest);
+
+      if (!AnnuityFits(found, months, interest, payment) ||
+          (found + 0.005 < CreditModel::maxCreditSum &&
+           AnnuityFits(found + 0.01, months, interest, payment))) {
+        Report("goal seek sum", i, Pair(found, payment));
+      }
+    } catch (const FinancePaymentException&) {
+      if (AnnuityFits(CreditModel::minCreditSum, months, interest, payment) &&
+          !AnnuityFits(CreditModel::maxCreditSum + 0.01, months, interest,
+                       payment)) {
+        Report("goal seek sum range", i, Pair(sum, payment));
+      }
+    }
+
+    try {
+      int found = CreditGoalSeek::Months(sum, payment, interest);
+
+      if (!AnnuityFits(sum, found, interest, payment) ||
+          (found > CreditModel::minCreditMonths &&
+           AnnuityFits(sum, found - 1, interest, payment))) {
+        Report("goal seek months", i, Pair(found, months));
+      }
+    } catch (const FinancePaymentException&) {
+      if (AnnuityFits(sum, CreditModel::maxCreditMonths, interest, payment)) {
+        Report("goal seek months range", i, Pair(sum, payment));
+      }
+    }
+  }
+}
+
+struct ScenarioInput {
+  double sum;
+  int months;
+  double interest;
+  CreditModel::CreditType type;
+  CreditModel::PaymentRounding rounding;
+  std::vector<CreditPrepayment> prepayments;
+  std::vector<CreditHoliday> holidays;
+};
+
+struct ScenarioOutput {
+  CreditTotals totals;
+  int months = 0;
+  // Остаток долга перед последним месяцем кредита
+  double lastBalance = 0;
+};
+
+// Помесячный цикл кредита с событиями: в каждом месяце перебираются все
+// каникулы и погашения, повторения погашений проверяются по остатку от
+// деления
+ScenarioOutput BaselineScenario(const ScenarioInput& input) {
+  bool annuity = input.type == CreditModel::Annuity;
+  bool round = !annuity && input.rounding == CreditModel::RoundToKopecks;
+  double monthInterest = input.interest / (100 * 12);
+  auto paymentFor = [&](double debt, int left) {
+    return annuity ? BaselineAnnuity(debt, left, input.interest).paymentMin
+                   : debt / left;
+  };
+
+  ScenarioOutput output;
+  output.totals.paymentMin = std::numeric_limits<double>::infinity();
+  double total = 0;
+  Money roundedTotal;
+  auto paid = [&](double amount) {
+    total += amount;
+    roundedTotal += Money::FromDouble(amount);
+  };
+  auto count = [&](double monthPay) {
+    output.totals.paymentMin = std::min(output.totals.paymentMin, monthPay);
+    output.totals.paymentMax = std::max(output.totals.paymentMax, monthPay);
+  };
+
+  double balance = input.sum;
+  int left = input.months;
+  double payment = paymentFor(balance, left);
+
+  for (int month = 1; left > 0; ++month) {
+    output.lastBalance = balance;
+    output.months = month;
+    bool holiday = false;
+
+    for (const CreditHoliday& item : input.holidays) {
+      if (month >= item.month && month < item.month + item.length) {
+        holiday = true;
+      }
+    }
+
+    if (holiday) {
+      balance += balance * monthInterest;
+      payment = paymentFor(balance, left);
+    } else if (left == 1) {
+      double lastPayment = balance * (1 + monthInterest);
+
+      if (round) {
+        lastPayment = BaselineRound(lastPayment, 2);
+      }
+
+      paid(lastPayment);
+      count(annuity && std::abs(lastPayment - payment) < 0.005 ? payment
+                                                               : lastPayment);
+      break;
+    } else {
+      double payAdd = balance * monthInterest;
+      double monthPay = annuity ? payment : payment + payAdd;
+      balance -= annuity ? payment - payAdd : payment;
+
+      if (round) {
+        monthPay = BaselineRound(monthPay, 2);
+      }
+
+      paid(monthPay);
+      count(monthPay);
+      --left;
+    }
+
+    for (const CreditPrepayment& item : input.prepayments) {
+      bool due = item.period > 0 ? month >= item.month &&
+                                       (month - item.month) % item.period == 0
+                                 : month == item.month;
+
+      if (!due || left == 0) {
+        continue;
+      }
+
+      double amount = std::min(item.amount, balance);
+      balance -= amount;
+
+      if (balance < 0.005) {
+        amount += balance;
+        balance = 0;
+      }
+
+      paid(amount);
+
+      if (balance == 0) {
+        left = 0;
+      } else if (item.effect == CreditPrepayment::ReducePayment) {
+        payment = paymentFor(balance, left);
+      } else {
+        double exact = annuity ? -std::log1p(-balance * monthInterest /
+                                             payment) /
+                                     std::log1p(monthInterest)
+                               : balance / payment;
+        left = std::clamp(static_cast<int>(std::ceil(exact - 1E-9)), 1, left);
+      }
+    }
+  }
+
+  if (std::isinf(output.totals.paymentMin)) {
+    output.totals.paymentMin = 0;
+  }
+
+  output.totals.totalPayment = round ? roundedTotal.ToDouble() : total;
+  output.totals.overPayment = output.totals.totalPayment - input.sum;
+  return output;
+}
+
+ScenarioInput RandomScenario(std::mt19937_64& random, int index) {
+  std::uniform_int_distribution<int> d(0, 1000000);
+  ScenarioInput input;
+  input.sum = d(random) % 2 ? d(random) * 10.0 + d(random) % 100 / 100.0
+                            : 1000 + d(random) / 10.0;
+  input.months = 1 + d(random) % (index % 4 ? 60 : 600);
+  input.interest = 0.01 + d(random) % 3000 / 100.0;
+  input.type = d(random) % 2 ? CreditModel::Annuity
+                             : CreditModel::Differentiated;
+  input.rounding = d(random) % 2 ? CreditModel::RoundToKopecks
+                                 : CreditModel::Unrounded;
+
+  int prepayments = d(random) % 5;
+
+  for (int k = 0; k < prepayments; ++k) {
+    CreditPrepayment prepayment;
+    prepayment.month = 1 + d(random) % (input.months + 5);
+    // Крупные погашения гасят кредит за несколько повторений, мелкие
+    // повторяются много раз
+    double share = d(random) % 3 ? (d(random) % 100) / 10000.0
+                                 : (d(random) % 1000) / 1000.0;
+    prepayment.amount = std::round(input.sum * share * 100) / 100 + 0.01;
+    prepayment.period = d(random) % 3 ? 1 + d(random) % 12 : 0;
+    prepayment.effect = d(random) % 2 ? CreditPrepayment::ReduceTerm
+                                      : CreditPrepayment::ReducePayment;
+    input.prepayments.push_back(prepayment);
+  }
+
+  // Каникулы могут пересекаться и примыкать друг к другу
+  int holidays = d(random) % 2 ? d(random) % 4 : 0;
+
+  for (int k = 0; k < holidays; ++k) {
+    input.holidays.push_back(
+        {1 + d(random) % (input.months + 3), 1 + d(random) % 6});
+  }
+
+  return input;
+}
+
+/**
+ * @brief CreditScenario против помесячного цикла: итоги и срок, а для
+ * графика - сумма платежей, остаток перед последним месяцем и нулевой
+ * остаток в конце. Расчет без графика перескакивает между событиями,
+ * поэтому суммы сравниваются с относительной точностью 1E-9.
+ */
+void CheckCreditScenarios(std::mt19937_64& random) {
+  for (int i = 0; i < 20000; ++i) {
+    ScenarioInput input = RandomScenario(random, i);
+    ScenarioOutput base = BaselineScenario(input);
+    CreditScenario scenario(input.sum, input.months, input.interest,
+                            input.type, input.rounding);
+    CreditScenarioResult result =
+        scenario.Calculate(input.prepayments, input.holidays);
+    CreditSchedule schedule;
+    CreditScenarioResult scheduled =
+        scenario.Calculate(input.prepayments, input.holidays, &schedule);
+
+    double tolerance = 1E-9 * base.totals.totalPayment;
+    auto near = [&](double lhs, double rhs) {
+      return std::abs(lhs - rhs) <= tolerance;
+    };
+
+    for (const CreditScenarioResult& item : {result, scheduled}) {
+      if (item.months != base.months ||
+          !near(item.totals.totalPayment, base.totals.totalPayment) ||
+          !near(item.totals.overPayment, base.totals.overPayment) ||
+          !near(item.totals.paymentMin, base.totals.paymentMin) ||
+          !near(item.totals.paymentMax, base.totals.paymentMax)) {
+        Report("scenario totals", i,
+               Pair(item.totals.totalPayment, base.totals.totalPayment) +
+                   ", months " + Pair(item.months, base.months));
+      }
+    }
+
+    double paid = 0;
+
+    for (double payment : schedule.payments) {
+      paid += payment;
+    }
+
+    std::size_t size = schedule.Size();
+    double lastBalance = size > 1 ? schedule.balances[size - 2] : input.sum;
+
+    if (size != static_cast<std::size_t>(base.months) ||
+        !near(paid, base.totals.totalPayment) ||
+        !near(lastBalance, base.lastBalance) ||
+        std::abs(schedule.balances.back()) > tolerance) {
+      Report("scenario schedule", i, Pair(paid, base.totals.totalPayment));
+    }
+  }
+}
+
+DepositInput RandomDeposit(std::mt19937_64& random, int index) {
+  std::uniform_int_distribution<int> d(0, 1000000);
+  DepositInput input;
+  input.sum = d(random) % 2 ? d(random) * 10.0 + d(random) % 100 / 100.0
+                            : d(random) / 100.0 + 0.01;
+  input.months = 1 + d(random) % (index % 10 ? 36 : 600);
+  input.interest = 0.01 + d(random) % 3000 / 100.0;
+  input.tax = 13;
+  input.payPeriod =
+      static_cast<DepositModel::PayPeriodDepositType>(d(random) % 3);
+  input.capitalization = d(random) % 2;
+  input.year = 2000 + d(random) % 20;
+  input.month = 1 + d(random) % 12;
+
+  // Каждое третье начало срока - в последний день месяца
+  if (d(random) % 3) {
+    input.day = 1 + d(random) % 28;
+  } else {
+    input.day = BaselineDaysCount(input.month, input.year);
+  }
+
+  int count = d(random) % 6;
+
+  for (int k = 0; k < count; ++k) {
+    int year = input.year + d(random) % 4;
+    int month = 1 + d(random) % 12;
+    int day = d(random) % 4 ? 1 + d(random) % 28 : input.day;
+    day = std::min(day, BaselineDaysCount(month, year));
+    double amount = d(random) % (d(random) % 2 ? 1000 : 100000) +
+                    d(random) % 100 / 100.0 + 0.01;
+    input.operations.emplace_back(year, month, day,
+                                  d(random) % 2 ? amount : -amount);
+  }
+
+  return input;
+}
+
+/**
+ * @brief Расчет вклада против посуточного цикла на Money: при начислении
+ * PerDay - до копейки, включая нехватку средств, при PerSpan - с
+ * расхождением не больше копейки за каждое округление.
+ */
+void CheckDeposits(std::mt19937_64& random) {
+  for (int i = 0; i < 20000; ++i) {
+    DepositInput input = RandomDeposit(random, i);
+    DepositOutput base = BaselineDeposit(input);
+    DepositOutput perDay = EngineDeposit(input, DepositModel::PerDay);
+
+    if (perDay.noMoney != base.noMoney || perDay.interest != base.interest ||
+        perDay.deposit != base.deposit || perDay.tax != base.tax) {
+      Report("deposit per day", i, Pair(perDay.deposit, base.deposit));
+    }
+
+    if (base.noMoney) {
+      continue;
+    }
+
+    DepositOutput perSpan = EngineDeposit(input, DepositModel::PerSpan);
+    // Округляется каждый месяц, а при ежедневной капитализации каждый день.
+    // Расхождение округления растет вместе со вкладом
+    double roundings = input.months + 1;
+
+    if (input.payPeriod == DepositModel::Day && input.capitalization) {
+      roundings = (input.months + 1) * 31.0;
+    }
+
+    double growth = std::exp(input.interest / 100 * (input.months + 1) / 12);
+    double tolerance = 0.01 * roundings * growth + 1E-9;
+
+    if (perSpan.noMoney ||
+        std::abs(perSpan.interest - base.interest) > tolerance ||
+        std::abs(perSpan.deposit - base.deposit) > tolerance ||
+        std::abs(perSpan.tax - base.tax) > tolerance) {
+      Report("deposit per span", i, Pair(perSpan.interest, base.interest));
+    }
+  }
+}
+
+}  // namespace
+
+}  // namespace s21
+
+int main() {
+  std::mt19937_64 random(2026);
+  s21::CheckCreditTotals(random);
+  s21::CheckCreditBatch(random);
+  s21::CheckGoalSeek(random);
+  s21::CheckCreditScenarios(random);
+  s21::CheckDeposits(random);
+
+  if (s21::failures > 0) {
+    std::fprintf(stderr, "%d mismatches\n", s21::failures);
+    return 1;
+  }
+
+  std::printf("finance engines match the baseline loops\n");
+  return 0;
+}
@@ -0,0 +1,115 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#include "CreditGridModel.h"
+
+#include <QColor>
+#include <algorithm>
+#include <cmath>
+
+namespace s21 {
+
+CreditGridModel::CreditGridModel(QObject* parent)
+    : QAbstractTableModel(parent),
+      _grid(),
+      _value(Payment),
+      minimum(0),
+      maximum(0) {}
+
+void CreditGridModel::SetGrid(const CreditGrid& newGrid) {
+  beginResetModel();
+  // Присваивание переиспользует память векторов сетки
+  _grid = newGrid;
+  UpdateRange();
+  endResetModel();
+}
+
+void CreditGridModel::SetValue(Value newValue) {
+  beginResetModel();
+  _value = newValue;
+  UpdateRange();
+  endResetModel();
+}
+
+void CreditGridModel::Clear() {
+  if (_grid.rates != 0) {
+    beginResetModel();
+    _grid.Clear();
+    endResetModel();
+  }
+}
+
+int CreditGridModel::rowCount(const QModelIndex& parent) const {
+  return parent.isValid() ? 0 : _grid.rates;
+}
+
+int CreditGridModel::columnCount(const QModelIndex& parent) const {
+  return parent.isValid() ? 0 : _grid.Terms();
+}
+
+QVariant CreditGridModel::data(const QModelIndex& index, int role) const {
+  if (!index.isValid()) {
+    return {};
+  }
+
+  double value = Values()[_grid.Index(index.row(), index.column())];
+
+  if (role == Qt::DisplayRole) {
+    return QString::number(value, 'f', 2);
+  }
+
+  if (role == Qt::TextAlignmentRole) {
+    return QVariant(Qt::AlignRight | Qt::AlignVCenter);
+  }
+
+  if (role == Qt::BackgroundRole) {
+    // Платежи по срокам различаются на порядки, поэтому шкала
+    // логарифмическая, если все значения положительны
+    double share = 0;
+
+    if (maximum > minimum && minimum > 0) {
+      share = std::log(value / minimum) / std::log(maximum / minimum);
+    } else if (maximum > minimum) {
+      share = (value - minimum) / (maximum - minimum);
+    }
+
+    // Оттенок от зеленого (1/3) до красного (0)
+    return QColor::fromHsvF((1 - share) / 3, 0.35, 1);
+  }
+
+  return {};
+}
+
+QVariant CreditGridModel::headerData(int section, Qt::Orientation orientation,
+                                     int role) const {
+  if (role != Qt::DisplayRole) {
+    return {};
+  }
+
+  if (orientation == Qt::Vertical) {
+    return QString::number(_grid.Interest(section), 'f', 2) + " %";
+  }
+
+  return QString::number(_grid.Months(section)) + " мес.";
+}
+
+const std::vector<double>& CreditGridModel::Values() const noexcept {
+  return _value == Payment ? _grid.payments : _grid.overPayments;
+}
+
+void CreditGridModel::UpdateRange() noexcept {
+  const std::vector<double>& values = Values();
+
+  if (values.empty()) {
+    minimum = 0;
+    maximum = 0;
+    return;
+  }
+
+  auto range = std::minmax_element(values.begin(), values.end());
+  minimum = *range.first;
+  maximum = *range.second;
+}
+
+}  // namespace s21
@@ -0,0 +1,54 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALCV2_CREDITGRIDMODEL_H
+#define SMARTCALCV2_CREDITGRIDMODEL_H
+
+#include <QAbstractTableModel>
+
+#include "../models/credit/creditGrid.h"
+
+namespace s21 {
+
+// Табличная модель сетки платежей по ставкам (строки) и срокам (столбцы).
+// Ячейки окрашиваются как тепловая карта: от зеленого для наименьшего
+// значения сетки до красного для наибольшего
+class CreditGridModel final : public QAbstractTableModel {
+  Q_OBJECT
+
+ public:
+  enum Value { Payment, OverPayment };
+
+  explicit CreditGridModel(QObject* parent = nullptr);
+
+  CreditGridModel(const CreditGridModel& other) = delete;
+  CreditGridModel(CreditGridModel&& other) = delete;
+  CreditGridModel& operator=(const CreditGridModel& other) = delete;
+  CreditGridModel& operator=(CreditGridModel&& other) = delete;
+  ~CreditGridModel() override = default;
+
+  void SetGrid(const CreditGrid& newGrid);
+  void SetValue(Value newValue);
+  void Clear();
+
+  [[nodiscard]] int rowCount(const QModelIndex& parent) const override;
+  [[nodiscard]] int columnCount(const QModelIndex& parent) const override;
+  [[nodiscard]] QVariant data(const QModelIndex& index,
+                              int role) const override;
+  [[nodiscard]] QVariant headerData(int section, Qt::Orientation orientation,
+                                    int role) const override;
+
+ private:
+  [[nodiscard]] const std::vector<double>& Values() const noexcept;
+  void UpdateRange() noexcept;
+
+  CreditGrid _grid;
+  Value _value;
+  double minimum;
+  double maximum;
+};
+
+}  // namespace s21
+
+#endif  // SMARTCALCV2_CREDITGRIDMODEL_H
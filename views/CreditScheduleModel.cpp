@@ -0,0 +1,81 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#include "CreditScheduleModel.h"
+
+#include <utility>
+
+namespace s21 {
+
+CreditScheduleModel::CreditScheduleModel(QObject* parent)
+    : QAbstractTableModel(parent) {}
+
+void CreditScheduleModel::SetSchedule(CreditSchedule newSchedule) {
+  beginResetModel();
+  _schedule = std::move(newSchedule);
+  endResetModel();
+}
+
+void CreditScheduleModel::Clear() {
+  if (_schedule.Size() != 0) {
+    beginResetModel();
+    _schedule.Clear();
+    endResetModel();
+  }
+}
+
+int CreditScheduleModel::rowCount(const QModelIndex& parent) const {
+  return parent.isValid() ? 0 : static_cast<int>(_schedule.Size());
+}
+
+int CreditScheduleModel::columnCount(const QModelIndex& parent) const {
+  return parent.isValid() ? 0 : ColumnsCount;
+}
+
+QVariant CreditScheduleModel::data(const QModelIndex& index, int role) const {
+  if (!index.isValid()) {
+    return {};
+  }
+
+  if (role == Qt::TextAlignmentRole) {
+    return QVariant(Qt::AlignRight | Qt::AlignVCenter);
+  }
+
+  if (role != Qt::DisplayRole) {
+    return {};
+  }
+
+  auto row = static_cast<std::size_t>(index.row());
+  double value = 0;
+
+  if (index.column() == Payment) {
+    value = _schedule.payments[row];
+  } else if (index.column() == Principal) {
+    value = _schedule.principals[row];
+  } else if (index.column() == Interest) {
+    value = _schedule.interests[row];
+  } else {
+    value = _schedule.balances[row];
+  }
+
+  return QString::number(value, 'f', 2);
+}
+
+QVariant CreditScheduleModel::headerData(int section,
+                                         Qt::Orientation orientation,
+                                         int role) const {
+  if (role != Qt::DisplayRole) {
+    return {};
+  }
+
+  if (orientation == Qt::Vertical) {
+    return section + 1;
+  }
+
+  static const char* const titles[] = {"Платеж", "Основной долг", "Проценты",
+                                       "Остаток"};
+  return QString(titles[section]);
+}
+
+}  // namespace s21
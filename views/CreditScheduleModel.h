@@ -0,0 +1,47 @@
+//
+// Created by bulatruslanovich on 19/10/2026.
+//
+
+#ifndef SMARTCALCV2_CREDITSCHEDULEMODEL_H
+#define SMARTCALCV2_CREDITSCHEDULEMODEL_H
+
+#include <QAbstractTableModel>
+
+#include "../models/credit/creditSchedule.h"
+
+namespace s21 {
+
+// Табличная модель графика платежей. Таблица запрашивает данные только
+// видимых ячеек, поэтому строки не создаются заранее, а значения
+// форматируются при отрисовке прямо из столбцов графика
+class CreditScheduleModel final : public QAbstractTableModel {
+  Q_OBJECT
+
+ public:
+  explicit CreditScheduleModel(QObject* parent = nullptr);
+
+  CreditScheduleModel(const CreditScheduleModel& other) = delete;
+  CreditScheduleModel(CreditScheduleModel&& other) = delete;
+  CreditScheduleModel& operator=(const CreditScheduleModel& other) = delete;
+  CreditScheduleModel& operator=(CreditScheduleModel&& other) = delete;
+  ~CreditScheduleModel() override = default;
+
+  void SetSchedule(CreditSchedule newSchedule);
+  void Clear();
+
+  [[nodiscard]] int rowCount(const QModelIndex& parent) const override;
+  [[nodiscard]] int columnCount(const QModelIndex& parent) const override;
+  [[nodiscard]] QVariant data(const QModelIndex& index,
+                              int role) const override;
+  [[nodiscard]] QVariant headerData(int section, Qt::Orientation orientation,
+                                    int role) const override;
+
+ private:
+  enum Column { Payment, Principal, Interest, Balance, ColumnsCount };
+
+  CreditSchedule _schedule;
+};
+
+}  // namespace s21
+
+#endif  // SMARTCALCV2_CREDITSCHEDULEMODEL_H
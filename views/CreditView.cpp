@@ -4,7 +4,12 @@
 
 #include "CreditView.h"
 
+#include <QComboBox>
+#include <QHeaderView>
+#include <QLineEdit>
 #include <QMessageBox>
+#include <QSpinBox>
+#include <algorithm>
 
 #include "ViewHelpers.h"
  #include "../ui/ui_CreditView.h"
@@ -16,9 +21,13 @@ CreditView::CreditView(ICreditController* controller, ICreditModelPublic* model,
     : QWidget(parent),
       _ui(new Ui::CreditView),
       _controller(controller),
-      _model(model) {
+      _model(model),
+      _scheduleModel(new CreditScheduleModel(this)),
+      _gridModel(new CreditGridModel(this)) {
 
   _ui->setupUi(this);
+  SetupScheduleTable();
+  SetupGridTable();
   SetupCreditButtons();
   _model->AddObserver(static_cast<IObserverCreditUpdate*>(this));
   _model->AddObserver(static_cast<IObserverCreditError*>(this));
@@ -34,10 +43,12 @@ CreditView::~CreditView() {
 void CreditView::Update() {
   UpdateInputFieldsFromModel();
   UpdateResultFromModel();
+  UpdateGridFromModel();
 }
 
 void CreditView::Error(const std::pair<std::string, std::string>& error) {
   UpdateResultFromModel();
+  UpdateGridFromModel();
 
   auto errorText = QString::fromStdString(error.second);
 
@@ -47,6 +58,10 @@ void CreditView::Error(const std::pair<std::string, std::string>& error) {
     SetCreditMonthsError(errorText);
   } else if (error.first == "interest") {
     SetCreditInterestError(errorText);
+  } else if (error.first == "events") {
+    SetCreditEventsError(errorText);
+  } else if (error.first == "payment") {
+    SetCreditPaymentError(errorText);
   } else {
     QMessageBox::critical(0, "Ошибка", errorText);
   }
@@ -55,6 +70,34 @@ void CreditView::Error(const std::pair<std::string, std::string>& error) {
 void CreditView::SetupCreditButtons() {
   connect(_ui->creditCalcButton, SIGNAL(clicked()), this,
           SLOT(HandleCreditButton()));
+  connect(_ui->addPrepaymentButton, SIGNAL(clicked()), this,
+          SLOT(HandleAddPrepaymentButton()));
+  connect(_ui->addHolidayButton, SIGNAL(clicked()), this,
+          SLOT(HandleAddHolidayButton()));
+  connect(_ui->seekInterestButton, SIGNAL(clicked()), this,
+          SLOT(HandleSeekInterestButton()));
+  connect(_ui->seekSumButton, SIGNAL(clicked()), this,
+          SLOT(HandleSeekSumButton()));
+  connect(_ui->seekMonthsButton, SIGNAL(clicked()), this,
+          SLOT(HandleSeekMonthsButton()));
+
+  // Сетка пересчитывается сразу при изменении диапазонов
+  connect(_ui->gridInterestBeginBox, SIGNAL(valueChanged(double)), this,
+          SLOT(HandleGridChanged()));
+  connect(_ui->gridInterestEndBox, SIGNAL(valueChanged(double)), this,
+          SLOT(HandleGridChanged()));
+  connect(_ui->gridRatesBox, SIGNAL(valueChanged(int)), this,
+          SLOT(HandleGridChanged()));
+  connect(_ui->gridMonthsBeginBox, SIGNAL(valueChanged(int)), this,
+          SLOT(HandleGridChanged()));
+  connect(_ui->gridMonthsEndBox, SIGNAL(valueChanged(int)), this,
+          SLOT(HandleGridChanged()));
+  connect(_ui->creditTabs, SIGNAL(currentChanged(int)), this,
+          SLOT(HandleGridChanged()));
+  connect(_ui->creditTabs, SIGNAL(currentChanged(int)), this,
+          SLOT(HandleScheduleTabChanged()));
+  connect(_ui->gridValueBox, SIGNAL(currentIndexChanged(int)), this,
+          SLOT(HandleGridValueChanged(int)));
 
   connect(_ui->creditSumEdit, SIGNAL(textChanged(QString)), this,
           SLOT(HandleCreditSumChanged()));
@@ -62,6 +105,28 @@ void CreditView::SetupCreditButtons() {
           SLOT(HandleCreditMonthsChanged()));
   connect(_ui->creditInterestEdit, SIGNAL(textChanged(QString)), this,
           SLOT(HandleCreditInterestChanged()));
+  connect(_ui->creditPaymentEdit, SIGNAL(textChanged(QString)), this,
+          SLOT(HandleCreditPaymentChanged()));
+}
+
+void CreditView::SetupScheduleTable() {
+  _ui->creditScheduleTable->setModel(_scheduleModel);
+  // Строки одной высоты: таблица не измеряет их содержимое и рисует только
+  // видимые строки даже для графика на 600 месяцев
+  _ui->creditScheduleTable->verticalHeader()->setSectionResizeMode(
+      QHeaderView::Fixed);
+  _ui->creditScheduleTable->horizontalHeader()->setSectionResizeMode(
+      QHeaderView::Stretch);
+}
+
+void CreditView::SetupGridTable() {
+  _ui->creditGridTable->setModel(_gridModel);
+  // Размеры ячеек не зависят от содержимого, поэтому сетка на сотни тысяч
+  // ячеек перерисовывается только в видимой части
+  _ui->creditGridTable->verticalHeader()->setSectionResizeMode(
+      QHeaderView::Fixed);
+  _ui->creditGridTable->horizontalHeader()->setSectionResizeMode(
+      QHeaderView::Fixed);
 }
 
 void CreditView::UpdateInputFieldsFromModel() {
@@ -73,6 +138,8 @@ void CreditView::UpdateInputFieldsFromModel() {
     _ui->annuityRadio->setChecked(true);
   }
 
+  _ui->roundPaymentsBox->setChecked(_model->GetCreditRounding());
+
   _ui->creditSumEdit->setText(ViewHelpers::DoubleToQStr(_model->GetSum(), 2));
 
   int months = _model->GetMonths();
@@ -102,15 +169,32 @@ void CreditView::UpdateResultFromModel() {
 
     _ui->creditRes2->setText(QString::number(overPay, 'f', 2));
     _ui->creditRes3->setText(QString::number(total, 'f', 2));
+    UpdateScheduleFromModel();
   } else {
     ResetResult();
   }
 }
 
+void CreditView::UpdateScheduleFromModel() {
+  // График строится моделью при запросе, поэтому запрашивается, только
+  // когда открыта его вкладка
+  if (_ui->creditTabs->currentWidget() == _ui->scheduleTab &&
+      _model->IsCreditCalc()) {
+    _scheduleModel->SetSchedule(_model->GetSchedule());
+  } else {
+    _scheduleModel->Clear();
+  }
+}
+
+void CreditView::UpdateGridFromModel() {
+  _gridModel->SetGrid(_model->GetCreditGrid());
+}
+
 void CreditView::ResetResult() {
   _ui->creditRes1->setText("-");
   _ui->creditRes2->setText("-");
   _ui->creditRes3->setText("-");
+  _scheduleModel->Clear();
 }
 
 void CreditView::SetCreditSumError(const QString& error) {
@@ -131,6 +215,17 @@ void CreditView::SetCreditInterestError(const QString& error) {
   QMessageBox::critical(0, "Ошибка", error);
 }
 
+void CreditView::SetCreditPaymentError(const QString& error) {
+  ResetResult();
+  _ui->creditPaymentEdit->setStyleSheet("border: 1px solid red; color: red;");
+  QMessageBox::critical(0, "Ошибка", error);
+}
+
+void CreditView::SetCreditEventsError(const QString& error) {
+  ResetResult();
+  QMessageBox::critical(0, "Ошибка", error);
+}
+
 void CreditView::ResetCreditSumError() {
   _ui->creditSumEdit->setStyleSheet("");
 }
@@ -143,15 +238,18 @@ void CreditView::ResetCreditInterestError() {
   _ui->creditInterestEdit->setStyleSheet("");
 }
 
+void CreditView::ResetCreditPaymentError() {
+  _ui->creditPaymentEdit->setStyleSheet("");
+}
+
 void CreditView::ResetAllErrors() {
+  ResetCreditPaymentError();
   ResetCreditInterestError();
   ResetCreditMonthsError();
   ResetCreditSumError();
 }
 
-void CreditView::HandleCreditButton() {
-  ResetResult();
-
+bool CreditView::ReadCreditSum() {
   bool isCorrectInput;
 
   double sum =
@@ -159,27 +257,157 @@ void CreditView::HandleCreditButton() {
 
   if (!isCorrectInput) {
     SetCreditSumError("С полем суммы какие приколы 0_0");
-    return;
+    return false;
   }
 
+  _controller->SetCreditSum(QString::number(sum, 'f', 2).toDouble());
+  return true;
+}
+
+bool CreditView::ReadCreditMonths() {
+  bool isCorrectInput;
+
   int months =
       _ui->creditMonthEdit->text().replace(",", ".").toInt(&isCorrectInput);
 
   if (!isCorrectInput) {
     SetCreditMonthsError("Полю месяцов не очень хорошо -_-");
-    return;
+    return false;
   }
 
-  int interest = _ui->creditInterestEdit->text().replace(",", ".").toDouble(
+  _controller->SetCreditMonths(months);
+  return true;
+}
+
+bool CreditView::ReadCreditInterest() {
+  bool isCorrectInput;
+
+  double interest = _ui->creditInterestEdit->text().replace(",", ".").toDouble(
       &isCorrectInput);
 
   if (!isCorrectInput) {
     SetCreditInterestError("Проценты - это от 0 до 100, если что 0_0");
+    return false;
+  }
+
+  _controller->SetCreditInterest(QString::number(interest, 'f', 2).toDouble());
+  return true;
+}
+
+bool CreditView::ReadCreditPayment(double& payment) {
+  bool isCorrectInput;
+
+  payment = _ui->creditPaymentEdit->text().replace(",", ".").toDouble(
+      &isCorrectInput);
+
+  if (!isCorrectInput) {
+    SetCreditPaymentError("Платеж должен быть числом");
+    return false;
+  }
+
+  return true;
+}
+
+bool CreditView::ReadCreditEvents() {
+  _controller->ClearCreditEvents();
+
+  for (int i = 0; i < _ui->creditPrepaymentLayout->count(); ++i) {
+    auto* line = qobject_cast<QHBoxLayout*>(
+        _ui->creditPrepaymentLayout->itemAt(i)->layout());
+    auto* monthBox = qobject_cast<QSpinBox*>(line->itemAt(0)->widget());
+    auto* amountEdit = qobject_cast<QLineEdit*>(line->itemAt(1)->widget());
+    auto* periodBox = qobject_cast<QSpinBox*>(line->itemAt(2)->widget());
+    auto* effectBox = qobject_cast<QComboBox*>(line->itemAt(3)->widget());
+    bool isCorrectInput;
+
+    double amount =
+        amountEdit->text().replace(",", ".").toDouble(&isCorrectInput);
+
+    if (!isCorrectInput) {
+      SetCreditEventsError(
+          "Сумма досрочного погашения содержит некорректное значение!");
+      return false;
+    }
+
+    _controller->AddCreditPrepayment(
+        monthBox->value(), QString::number(amount, 'f', 2).toDouble(),
+        periodBox->value(), effectBox->currentIndex() == 0);
+  }
+
+  for (int i = 0; i < _ui->creditHolidayLayout->count(); ++i) {
+    auto* line = qobject_cast<QHBoxLayout*>(
+        _ui->creditHolidayLayout->itemAt(i)->layout());
+    auto* monthBox = qobject_cast<QSpinBox*>(line->itemAt(0)->widget());
+    auto* lengthBox = qobject_cast<QSpinBox*>(line->itemAt(1)->widget());
+    _controller->AddCreditHoliday(monthBox->value(), lengthBox->value());
+  }
+
+  return true;
+}
+
+void CreditView::AddPrepaymentLine() {
+  auto* line = new QHBoxLayout;
+
+  auto* monthBox = new QSpinBox;
+  monthBox->setRange(1, 600);
+  monthBox->setPrefix("Месяц ");
+  line->addWidget(monthBox);
+
+  auto* amountEdit = new QLineEdit;
+  amountEdit->setPlaceholderText("Сумма (руб.)");
+  line->addWidget(amountEdit);
+
+  auto* periodBox = new QSpinBox;
+  periodBox->setRange(0, 600);
+  periodBox->setPrefix("каждые ");
+  periodBox->setSuffix(" мес.");
+  periodBox->setSpecialValueText("Однократно");
+  line->addWidget(periodBox);
+
+  auto* effectBox = new QComboBox;
+  effectBox->addItem("Сократить срок");
+  effectBox->addItem("Уменьшить платеж");
+  line->addWidget(effectBox);
+
+  AddDeleteButton(line);
+  _ui->creditPrepaymentLayout->addLayout(line);
+}
+
+void CreditView::AddHolidayLine() {
+  auto* line = new QHBoxLayout;
+
+  auto* monthBox = new QSpinBox;
+  monthBox->setRange(1, 600);
+  monthBox->setPrefix("С месяца ");
+  line->addWidget(monthBox);
+
+  auto* lengthBox = new QSpinBox;
+  lengthBox->setRange(1, 600);
+  lengthBox->setSuffix(" мес.");
+  line->addWidget(lengthBox);
+
+  AddDeleteButton(line);
+  _ui->creditHolidayLayout->addLayout(line);
+}
+
+void CreditView::AddDeleteButton(QHBoxLayout* line) {
+  auto* button = new QPushButton;
+  button->resize(QSize(25, 25));
+  button->setIcon(QIcon(QPixmap(":/images/delete.png")));
+  button->setIconSize(QSize(16, 16));
+  line->addWidget(button);
+
+  connect(button, SIGNAL(clicked()), this, SLOT(DeleteEventLine()));
+}
+
+void CreditView::HandleCreditButton() {
+  ResetResult();
+
+  if (!ReadCreditSum() || !ReadCreditMonths() || !ReadCreditInterest() ||
+      !ReadCreditEvents()) {
     return;
   }
 
-  sum = QString::number(sum, 'f', 2).toDouble();
-  interest = QString::number(interest, 'f', 2).toDouble();
   ICreditType type;
 
   if (_ui->differentiatedRadio->isChecked()) {
@@ -188,18 +416,126 @@ void CreditView::HandleCreditButton() {
     type = Annuity;
   }
 
-  _controller->SetCreditSum(sum);
-  _controller->SetCreditMonths(months);
-  _controller->SetCreditInterest(interest);
   _controller->SetCreditType(type);
+  _controller->SetCreditRounding(_ui->roundPaymentsBox->isChecked());
 
   _controller->CalculateCredit();
 }
 
+// Подбор ведется по формуле аннуитета, поэтому досрочные погашения и
+// каникулы при подборе не учитываются
+void CreditView::HandleSeekInterestButton() {
+  ResetResult();
+  double payment;
+
+  if (!ReadCreditSum() || !ReadCreditMonths() || !ReadCreditPayment(payment)) {
+    return;
+  }
+
+  _controller->ClearCreditEvents();
+  _controller->SeekCreditInterest(payment);
+}
+
+void CreditView::HandleSeekSumButton() {
+  ResetResult();
+  double payment;
+
+  if (!ReadCreditMonths() || !ReadCreditInterest() ||
+      !ReadCreditPayment(payment)) {
+    return;
+  }
+
+  _controller->ClearCreditEvents();
+  _controller->SeekCreditSum(payment);
+}
+
+void CreditView::HandleSeekMonthsButton() {
+  ResetResult();
+  double payment;
+
+  if (!ReadCreditSum() || !ReadCreditInterest() ||
+      !ReadCreditPayment(payment)) {
+    return;
+  }
+
+  _controller->ClearCreditEvents();
+  _controller->SeekCreditMonths(payment);
+}
+
+void CreditView::HandleAddPrepaymentButton() { AddPrepaymentLine(); }
+
+void CreditView::HandleAddHolidayButton() { AddHolidayLine(); }
+
+void CreditView::DeleteEventLine() {
+  auto* deleteButton = qobject_cast<QPushButton*>(sender());
+  QLayout* line = ViewHelpers::FindParentLayout(deleteButton);
+
+  while (QLayoutItem* item = line->takeAt(0)) {
+    if (QWidget* widget = item->widget()) {
+      widget->hide();
+      widget->deleteLater();
+    }
+
+    delete item;
+  }
+
+  delete line;
+}
+
+void CreditView::HandleScheduleTabChanged() { UpdateScheduleFromModel(); }
+
+void CreditView::HandleGridChanged() {
+  if (_ui->creditTabs->currentWidget() != _ui->gridTab) {
+    return;
+  }
+
+  bool isCorrectInput;
+
+  double sum =
+      _ui->creditSumEdit->text().replace(",", ".").toDouble(&isCorrectInput);
+
+  if (!isCorrectInput) {
+    _gridModel->Clear();
+    return;
+  }
+
+  // Параметры передаются в модель, только если изменились, чтобы не
+  // сбрасывать результаты основного расчета при каждом шаге диапазона
+  sum = QString::number(sum, 'f', 2).toDouble();
+  ICreditType type =
+      _ui->differentiatedRadio->isChecked() ? Differentiated : Annuity;
+
+  if (sum != _model->GetSum()) {
+    _controller->SetCreditSum(sum);
+  }
+
+  if (type != _model->GetType()) {
+    _controller->SetCreditType(type);
+  }
+
+  double interestBegin = _ui->gridInterestBeginBox->value();
+  double interestEnd = _ui->gridInterestEndBox->value();
+  int monthsBegin = _ui->gridMonthsBeginBox->value();
+  int monthsEnd = _ui->gridMonthsEndBox->value();
+
+  _controller->CalculateCreditGrid(std::min(interestBegin, interestEnd),
+                                   std::max(interestBegin, interestEnd),
+                                   _ui->gridRatesBox->value(),
+                                   std::min(monthsBegin, monthsEnd),
+                                   std::max(monthsBegin, monthsEnd));
+}
+
+void CreditView::HandleGridValueChanged(int index) {
+  _gridModel->SetValue(index == 0 ? CreditGridModel::Payment
+                                  : CreditGridModel::OverPayment);
+}
+
 void CreditView::HandleCreditSumChanged() { ResetCreditSumError(); }
 
 void CreditView::HandleCreditMonthsChanged() { ResetCreditMonthsError(); }
 
 void CreditView::HandleCreditInterestChanged() { ResetCreditInterestError(); }
 
+void CreditView::HandleCreditPaymentChanged() { ResetCreditPaymentError(); }
+
 }  // namespace s21
\ No newline at end of file
@@ -5,11 +5,14 @@
 #ifndef SMARTCALCV2_CREDITVIEW_H
 #define SMARTCALCV2_CREDITVIEW_H
 
+#include <QHBoxLayout>
 #include <QWidget>
 
 #include "../interfaces/ICreditController.h"
 #include "../interfaces/ICreditModelPublic.h"
 #include "../interfaces/observers/IObserverCredit.h"
+#include "CreditGridModel.h"
+#include "CreditScheduleModel.h"
 
 
 namespace Ui {
@@ -38,27 +41,54 @@ class CreditView final : public QWidget,
 
  private:
   void SetupCreditButtons();
+  void SetupScheduleTable();
+  void SetupGridTable();
   void UpdateInputFieldsFromModel();
   void UpdateResultFromModel();
+  void UpdateScheduleFromModel();
+  void UpdateGridFromModel();
   void ResetResult();
+  bool ReadCreditSum();
+  bool ReadCreditMonths();
+  bool ReadCreditInterest();
+  bool ReadCreditPayment(double& payment);
+  bool ReadCreditEvents();
+  void AddPrepaymentLine();
+  void AddHolidayLine();
+  void AddDeleteButton(QHBoxLayout* line);
   void SetCreditSumError(const QString& error);
   void SetCreditMonthsError(const QString& error);
   void SetCreditInterestError(const QString& error);
+  void SetCreditPaymentError(const QString& error);
+  void SetCreditEventsError(const QString& error);
 
   void ResetCreditSumError();
   void ResetCreditMonthsError();
   void ResetCreditInterestError();
+  void ResetCreditPaymentError();
   void ResetAllErrors();
 
   Ui::CreditView* _ui;
   ICreditController* _controller;
   ICreditModelPublic* _model;
+  CreditScheduleModel* _scheduleModel;
+  CreditGridModel* _gridModel;
 
  private slots:
   void HandleCreditButton();
   void HandleCreditSumChanged();
   void HandleCreditMonthsChanged();
   void HandleCreditInterestChanged();
+  void HandleCreditPaymentChanged();
+  void HandleSeekInterestButton();
+  void HandleSeekSumButton();
+  void HandleSeekMonthsButton();
+  void HandleAddPrepaymentButton();
+  void HandleAddHolidayButton();
+  void DeleteEventLine();
+  void HandleScheduleTabChanged();
+  void HandleGridChanged();
+  void HandleGridValueChanged(int index);
 };
 
 }  // namespace s21
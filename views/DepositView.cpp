@@ -5,6 +5,7 @@
 #include "DepositView.h"
 
 #include <QDateEdit>
+#include <QFileDialog>
 #include <QMessageBox>
 
 #include "../ui/ui_DepositView.h"
@@ -26,6 +27,7 @@ DepositView::DepositView(IDepositController *controller,
   _model->AddObserver(static_cast<IObserverDepositUpdate *>(this));
   _model->AddObserver(static_cast<IObserverDepositError *>(this));
   ResetResult();
+  UpdateImportFromModel();
 }
 
 DepositView::~DepositView() { delete _ui; }
@@ -33,6 +35,7 @@ DepositView::~DepositView() { delete _ui; }
 void DepositView::Update() {
   UpdateInputFieldsFromModel();
   UpdateResultFromModel();
+  UpdateImportFromModel();
 }
 
 void DepositView::Error(const std::pair<std::string, std::string> &error) {
@@ -71,6 +74,11 @@ void DepositView::SetupDepositButtons() {
           SLOT(AddOperationReplenishment()));
   connect(_ui->addSubingButton, SIGNAL(clicked()), this,
           SLOT(AddOperationWithdrawal()));
+  // Слоты для загрузки операций из файла
+  connect(_ui->importOperationsButton, SIGNAL(clicked()), this,
+          SLOT(HandleImportButton()));
+  connect(_ui->clearImportButton, SIGNAL(clicked()), this,
+          SLOT(HandleClearImportButton()));
   // Слоты для обработки изменений в текстовых полях депозитного калькулятора
   connect(_ui->depositSumEdit, SIGNAL(textChanged(QString)), this,
           SLOT(HandleDepositSumChanged()));
@@ -108,6 +116,8 @@ void DepositView::UpdateInputFieldsFromModel() {
     _ui->depositCapitalizationCheckBox->setChecked(false);
   }
 
+  _ui->depositDailyAccrualBox->setChecked(_model->GetDepositDailyAccrual());
+
   IDepositType type =_model->GetDepositType();
 
   if (type == Day) {
@@ -134,6 +144,20 @@ void DepositView::UpdateResultFromModel() {
   }
 }
 
+void DepositView::UpdateImportFromModel() {
+  // Обновляем сведения о загруженных из файла операциях
+  std::size_t count = _model->GetImportedDepositOperationsCount();
+
+  if (count == 0) {
+    _ui->importedOperationsLabel->setText("Не загружены");
+  } else {
+    _ui->importedOperationsLabel->setText("Загружено операций: " +
+                                          QString::number(count));
+  }
+
+  _ui->clearImportButton->setEnabled(count != 0);
+}
+
 void DepositView::ResetResult() {
   _ui->depositResult1->setText("-");
   _ui->depositResult2->setText("-");
@@ -452,6 +476,8 @@ void DepositView::HandleDepositButton() {
 //  _controller->SetDepositTax(tax);
   _controller->SetDepositPeriodicityType(type);
   _controller->SetDepositCapitalization(capitalization);
+  _controller->SetDepositDailyAccrual(
+      _ui->depositDailyAccrualBox->isChecked());
   _controller->SetDepositDateStart(deposit_year, deposit_month, deposit_day);
   _controller->CalculateDeposit();
 }
@@ -484,6 +510,26 @@ void DepositView::DeleteOperationLine() {
   delete line;
 }
 
+void DepositView::HandleImportButton() {
+  QString path = QFileDialog::getOpenFileName(
+      this, "Загрузка операций", QString(),
+      "Таблицы (*.csv *.tsv *.txt);;Все файлы (*)");
+
+  if (path.isEmpty()) {
+    return;
+  }
+
+  _controller->ImportDepositOperations(path.toStdString());
+  UpdateImportFromModel();
+  UpdateResultFromModel();
+}
+
+void DepositView::HandleClearImportButton() {
+  _controller->ClearImportedDepositOperations();
+  UpdateImportFromModel();
+  UpdateResultFromModel();
+}
+
 void DepositView::HandleDepositSumChanged() { ResetDepositSumError(); }
 
 void DepositView::HandleDepositMonthsChanged() { ResetDepositMonthsError(); }
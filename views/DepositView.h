@@ -41,6 +41,7 @@ class DepositView final : public QWidget,
   void SetupDepositButtons();
   void UpdateInputFieldsFromModel();
   void UpdateResultFromModel();
+  void UpdateImportFromModel();
   void ResetResult();
   bool OperationsReplenishmentHandle();
   bool OperationsWithdrawalHandle();
@@ -70,6 +71,8 @@ class DepositView final : public QWidget,
   void AddOperationReplenishment();
   void AddOperationWithdrawal();
   void DeleteOperationLine();
+  void HandleImportButton();
+  void HandleClearImportButton();
 
   void HandleDepositSumChanged();
   void HandleDepositMonthsChanged();
@@ -4,8 +4,11 @@
 
 #include "GraphView.h"
 
+#include <iterator>
+#include <memory>
 #include <vector>
 
+#include "../helpers/decimationHelper.h"
 #include "widgets/qcustomplot.h"
  #include "../ui/ui_GraphView.h"
 #include "ViewHelpers.h"
@@ -19,8 +22,11 @@ GraphView::GraphView(IGraphController* controller, IGraphModelPublic* model,
       _controller(controller),
       _model(model) {
   _ui->setupUi(this);
+  _ui->graphPlot->xAxis->setLabel("X");
+  _ui->graphPlot->yAxis->setLabel("Y");
   SetupButtons();
   ResetResult();
+  Render();
   _model->AddObserver(static_cast<IObserverGraphUpdate*>(this));
   _model->AddObserver(static_cast<IObserverGraphError*>(this));
 }
@@ -46,30 +52,53 @@ void GraphView::UpdateGraphWindow(const QString& mathExpression) {
   Draw();
 }
 
-void GraphView::Update() {
-  UpdateInputFieldsFromModel();
-  UpdateResultFromModel();
-}
+void GraphView::Update() { emit GraphUpdated(); }
 
 void GraphView::Error(const std::pair<std::string, std::string>& error) {
+  emit GraphFailed(QString::fromStdString(error.first),
+                   QString::fromStdString(error.second));
+}
+
+void GraphView::GraphUpdatedHandle() {
+  std::shared_ptr<const GraphResult> result = _model->GetGraphResult();
+
+  if (result == nullptr) {
+    return;
+  }
+
+  UpdateInputFields(result->xBegin, result->xEnd, result->yBegin,
+                    result->yEnd);
+  UpdateResultFromModel(*result);
+  Render();
+}
+
+void GraphView::GraphFailedHandle(const QString& type, const QString& text) {
   ResetResult();
   UpdateInputFieldsFromModel();
 
-  auto errorText = QString::fromStdString(error.second);
-  if (error.first == "xGraph") {
+  if (type == "xGraph") {
     SetXBeginError("");
-    SetXEndError(errorText);
-  } else if (error.first == "yGraph") {
+    SetXEndError(text);
+  } else if (type == "yGraph") {
     SetYBeginError("");
-    SetYEndError(errorText);
-  } else if (error.first == "graphCalculation") {
+    SetYEndError(text);
+  } else if (type == "tGraph") {
+    SetTBeginError("");
+    SetTEndError(text);
+  } else if (type == "graphCalculation") {
     // ничего не делаем
   } else {
-    QMessageBox::critical(0, "Ошибка отрисовки графика", errorText);
+    QMessageBox::critical(0, "Ошибка отрисовки графика", text);
   }
+
+  Render();
 }
 
 void GraphView::SetupButtons() {
+  connect(this, SIGNAL(GraphUpdated()), this, SLOT(GraphUpdatedHandle()),
+          Qt::QueuedConnection);
+  connect(this, SIGNAL(GraphFailed(QString, QString)), this,
+          SLOT(GraphFailedHandle(QString, QString)), Qt::QueuedConnection);
   connect(_ui->backButton, SIGNAL(clicked()), this, SLOT(BackButtonHandle()));
   connect(_ui->drawButton, SIGNAL(clicked()), this, SLOT(DrawButtonHandle()));
   connect(_ui->defaultSettingsButton, SIGNAL(clicked()), this,
@@ -80,20 +109,30 @@ void GraphView::GraphPlotConfig(double _beginX, double _endX, double _beginY,
                                 double _endY) {
   _ui->graphPlot->xAxis->setRange(_beginX, _endX);
   _ui->graphPlot->yAxis->setRange(_beginY, _endY);
-  _ui->graphPlot->xAxis->setLabel("X");
-  _ui->graphPlot->yAxis->setLabel("Y");
+  _axesDirty = true;
+}
+
+void GraphView::Render() {
+  // Все изменения осей и данных за одно обновление модели отрисовываются
+  // одним вызовом replot
+  if (!_axesDirty && !_dataDirty) {
+    return;
+  }
+
+  _ui->graphPlot->replot();
+  _axesDirty = false;
+  _dataDirty = false;
 }
 
 void GraphView::UpdateInputFieldsFromModel() {
   // Обновляем данные для расчета по данным модели
-  double _beginX = _model->GetXBegin();
-  double _endX = _model->GetXEnd();
-  double _beginY = _model->GetYBegin();
-  double _endY = _model->GetYEnd();
+  UpdateInputFields(_model->GetXBegin(), _model->GetXEnd(),
+                    _model->GetYBegin(), _model->GetYEnd());
+}
 
-  _ui->graphPlot->clearGraphs();
+void GraphView::UpdateInputFields(double _beginX, double _endX, double _beginY,
+                                  double _endY) {
   GraphPlotConfig(_beginX, _endX, _beginY, _endY);
-  _ui->graphPlot->replot();
 
   _ui->xMinEdit->setText(ViewHelpers::DoubleToQStr(_beginX, 7));
   _ui->xMaxEdit->setText(ViewHelpers::DoubleToQStr(_endX, 7));
@@ -107,36 +146,213 @@ void GraphView::UpdateInputFieldsFromModel() {
   }
 }
 
-void GraphView::UpdateResultFromModel() {
-  const std::vector<std::pair<double, double>>& points = _model->GetPoints();
-
-  QVector<double> xVec, yVec;
-
-  for (auto& item : points) {
-    if (std::isnan(item.second) || std::isinf(item.second)) {
-      if (xVec.size() > 0) {
-        QCPGraph* graph = _ui->graphPlot->addGraph();
-        graph->setData(xVec, yVec);
-        _ui->graphPlot->replot();
-        xVec.clear();
-        yVec.clear();
-      }
-      continue;
+QPen GraphView::CurvePen(const GraphCurve& curve) {
+  static const Qt::GlobalColor colors[] = {
+      Qt::blue,     Qt::red,        Qt::darkGreen, Qt::magenta,
+      Qt::darkCyan, Qt::darkYellow, Qt::black,     Qt::darkRed};
+  // Производные рисуются цветом своей функции: первая - штрихами, вторая -
+  // точками
+  static const Qt::PenStyle styles[] = {Qt::SolidLine, Qt::DashLine,
+                                        Qt::DotLine};
+  QPen pen(colors[curve.function % std::size(colors)]);
+  pen.setStyle(styles[static_cast<std::size_t>(curve.derivative) %
+                      std::size(styles)]);
+  return pen;
+}
+
+void GraphView::UpdateResultFromModel(const GraphResult& result) {
+  int curves = static_cast<int>(result.curves.size());
+  int graphs = result.xOrdered ? curves : 0;
+  int contours = result.xOrdered ? 0 : curves;
+
+  // Графики переиспользуются между обновлениями, создаются и удаляются только
+  // при изменении количества функций
+  while (_graphs.size() > graphs) {
+    _ui->graphPlot->removeGraph(_graphs.takeLast());
+  }
+
+  while (_graphs.size() < graphs) {
+    _graphs.push_back(_ui->graphPlot->addGraph());
+  }
+
+  while (_contours.size() > contours) {
+    _ui->graphPlot->removePlottable(_contours.takeLast());
+  }
+
+  while (_contours.size() < contours) {
+    _contours.push_back(
+        new QCPCurve(_ui->graphPlot->xAxis, _ui->graphPlot->yAxis));
+  }
+
+  for (int i = 0; i < graphs; ++i) {
+    _graphs[i]->setPen(CurvePen(result.curves[i]));
+    UpdateCurve(_graphs[i], result.curves[i], result);
+  }
+
+  for (int i = 0; i < contours; ++i) {
+    _contours[i]->setPen(CurvePen(result.curves[i]));
+    UpdateContour(_contours[i], result.curves[i]);
+  }
+
+  if (result.grid.values.empty()) {
+    RemoveGrid();
+  } else {
+    UpdateGrid(result);
+  }
+
+  UpdateMarkers(result);
+  _dataDirty = true;
+}
+
+void GraphView::UpdateCurve(QCPGraph* graph, const GraphCurve& curve,
+                            const GraphResult& result) {
+  int columns = _ui->graphPlot->axisRect()->width();
+  std::vector<double> xs;
+  std::vector<double> ys;
+  std::vector<std::size_t> bounds{0};
+
+  for (std::size_t segment = 0; segment < curve.SegmentsCount(); ++segment) {
+    // Больше нескольких точек на столбец пикселей не видно, прореживаем
+    // до отрисовки
+    decimationHelper::Decimate(curve.xs, curve.ys, curve.bounds[segment],
+                               curve.bounds[segment + 1], result.xBegin,
+                               result.xEnd, columns, xs, ys);
+    bounds.push_back(xs.size());
+  }
+
+  // Участки выводятся одним графиком: между соседними участками вставляется
+  // точка со значением NaN, на которой QCustomPlot прерывает линию
+  std::size_t gaps = bounds.size() > 2 ? bounds.size() - 2 : 0;
+  QVector<QCPGraphData> data(static_cast<int>(xs.size() + gaps));
+  int index = 0;
+
+  for (std::size_t segment = 0; segment + 1 < bounds.size(); ++segment) {
+    if (segment > 0) {
+      data[index].key = (xs[bounds[segment] - 1] + xs[bounds[segment]]) / 2;
+      data[index].value = qQNaN();
+      ++index;
     }
 
-    xVec.push_back(item.first);
-    yVec.push_back(item.second);
+    for (std::size_t i = bounds[segment]; i < bounds[segment + 1]; ++i) {
+      data[index].key = xs[i];
+      data[index].value = ys[i];
+      ++index;
+    }
   }
 
-  QCPGraph* graph = _ui->graphPlot->addGraph();
-  graph->setData(xVec, yVec);
+  // Точки уже упорядочены по X, загружаем их в контейнер одним блоком
+  graph->data()->set(data, true);
+}
 
-  _ui->graphPlot->replot();
+void GraphView::UpdateContour(QCPCurve* contour, const GraphCurve& curve) {
+  // Точки идут вдоль кривой, поэтому не прореживаются по столбцам пикселей.
+  // Участки разделяются точкой NaN, на которой QCPCurve прерывает линию
+  std::size_t gaps = curve.SegmentsCount() > 1 ? curve.SegmentsCount() - 1 : 0;
+  QVector<QCPCurveData> data(static_cast<int>(curve.xs.size() + gaps));
+  int index = 0;
+
+  for (std::size_t segment = 0; segment < curve.SegmentsCount(); ++segment) {
+    if (segment > 0) {
+      data[index] = QCPCurveData(index, qQNaN(), qQNaN());
+      ++index;
+    }
+
+    for (std::size_t i = curve.bounds[segment]; i < curve.bounds[segment + 1];
+         ++i) {
+      data[index] = QCPCurveData(index, curve.xs[i], curve.ys[i]);
+      ++index;
+    }
+  }
+
+  // Параметр точек возрастает по порядку, загружаем их одним блоком
+  contour->data()->set(data, true);
+}
+
+void GraphView::UpdateGrid(const GraphResult& result) {
+  const GraphGrid& grid = result.grid;
+
+  if (_colorMap == nullptr) {
+    _colorMap =
+        new QCPColorMap(_ui->graphPlot->xAxis, _ui->graphPlot->yAxis);
+    QCPColorGradient gradient(QCPColorGradient::gpJet);
+    gradient.setNanHandling(QCPColorGradient::nhTransparent);
+    _colorMap->setGradient(gradient);
+  }
+
+  // Узлы сетки включают границы диапазонов, как и ячейки QCPColorMapData
+  QCPColorMapData* data = _colorMap->data();
+  data->setSize(static_cast<int>(grid.columns), static_cast<int>(grid.rows));
+  data->setRange(QCPRange(result.xBegin, result.xEnd),
+                 QCPRange(result.yBegin, result.yEnd));
+
+  for (std::size_t row = 0; row < grid.rows; ++row) {
+    for (std::size_t column = 0; column < grid.columns; ++column) {
+      data->setCell(static_cast<int>(column), static_cast<int>(row),
+                    grid.At(row, column));
+    }
+  }
+
+  // Диапазон цветов задается по конечным значениям из модели: автоматический
+  // пересчет QCustomPlot не пропускает NaN. Для постоянной функции диапазон
+  // расширяется, иначе QCustomPlot его не примет
+  if (grid.zMin < grid.zMax) {
+    _colorMap->setDataRange(QCPRange(grid.zMin, grid.zMax));
+  } else {
+    _colorMap->setDataRange(QCPRange(grid.zMin - 1, grid.zMax + 1));
+  }
+}
+
+void GraphView::UpdateMarkers(const GraphResult& result) {
+  // Порядок совпадает с GraphMarker::Kind: корни, минимумы, максимумы и
+  // пересечения
+  static const QCPScatterStyle::ScatterShape shapes[] = {
+      QCPScatterStyle::ssCircle, QCPScatterStyle::ssTriangle,
+      QCPScatterStyle::ssTriangleInverted, QCPScatterStyle::ssCross};
+  const int kinds = static_cast<int>(std::size(shapes));
+
+  if (result.markers.empty()) {
+    while (!_markers.empty()) {
+      _ui->graphPlot->removeGraph(_markers.takeLast());
+    }
+
+    return;
+  }
+
+  while (_markers.size() < kinds) {
+    QCPGraph* graph = _ui->graphPlot->addGraph();
+    graph->setLineStyle(QCPGraph::lsNone);
+    graph->setScatterStyle(
+        QCPScatterStyle(shapes[_markers.size()], Qt::black, 7));
+    // Точки рисуются поверх графиков функций
+    graph->setLayer("axes");
+    _markers.push_back(graph);
+  }
+
+  QVector<QVector<QCPGraphData>> data(kinds);
+
+  for (const GraphMarker& marker : result.markers) {
+    data[marker.kind].push_back(QCPGraphData(marker.x, marker.y));
+  }
+
+  for (int kind = 0; kind < kinds; ++kind) {
+    _markers[kind]->data()->set(data[kind]);
+  }
+}
+
+void GraphView::RemoveGrid() {
+  if (_colorMap != nullptr) {
+    _ui->graphPlot->removePlottable(_colorMap);
+    _colorMap = nullptr;
+  }
 }
 
 void GraphView::ResetResult() {
-  _ui->graphPlot->clearGraphs();
-  _ui->graphPlot->replot();
+  _ui->graphPlot->clearPlottables();
+  _graphs.clear();
+  _contours.clear();
+  _markers.clear();
+  _colorMap = nullptr;
+  _dataDirty = true;
 }
 
 void GraphView::ResetInputFields() {
@@ -144,6 +360,8 @@ void GraphView::ResetInputFields() {
   _ui->xMaxEdit->setText(ViewHelpers::DoubleToQStr(100, 7));
   _ui->yMinEdit->setText("");
   _ui->yMaxEdit->setText("");
+  _ui->tMinEdit->setText(ViewHelpers::DoubleToQStr(0.0, 7));
+  _ui->tMaxEdit->setText(ViewHelpers::DoubleToQStr(2 * M_PI, 7));
 }
 
 void GraphView::Draw() {
@@ -182,10 +400,28 @@ void GraphView::Draw() {
     return;
   }
 
+  double tBegin =
+      _ui->tMinEdit->text().replace(",", ".").toDouble(&isCorrectInput);
+
+  if (!isCorrectInput) {
+    SetTBeginError("Поле \"T от\" содержит некорректное значение!");
+    return;
+  }
+
+  double tEnd =
+      _ui->tMaxEdit->text().replace(",", ".").toDouble(&isCorrectInput);
+
+  if (!isCorrectInput) {
+    SetTEndError("Поле \"T до\" содержит некорректное значение!");
+    return;
+  }
+
   xBegin = QString::number(xBegin, 'f', 7).toDouble();
   xEnd = QString::number(xEnd, 'f', 7).toDouble();
   yBegin = QString::number(yBegin, 'f', 7).toDouble();
   yEnd = QString::number(yEnd, 'f', 7).toDouble();
+  tBegin = QString::number(tBegin, 'f', 7).toDouble();
+  tEnd = QString::number(tEnd, 'f', 7).toDouble();
 
   if (yBegin == yEnd) {
     _controller->SetYScaleAuto(true);
@@ -197,6 +433,11 @@ void GraphView::Draw() {
   _controller->SetEndX(xEnd);
   _controller->SetBeginY(yBegin);
   _controller->SetEndY(yEnd);
+  _controller->SetBeginT(tBegin);
+  _controller->SetEndT(tEnd);
+  _controller->SetGraphType(_ui->plotTypeBox->currentIndex());
+  _controller->SetDerivativeOrder(_ui->derivativeBox->currentIndex());
+  _controller->SetMarkersEnabled(_ui->markersBox->isChecked());
 
   _controller->CalculateGraph();
 }
@@ -204,6 +445,8 @@ void GraphView::Draw() {
 void GraphView::SetXBeginError(const QString& errorText) {
   ResetResult();
   _ui->xMinEdit->setStyleSheet("border: 1px solid red; color: red;");
+  Render();
+
   if (!errorText.isEmpty()) {
     QMessageBox::critical(0, "Ошибка отрисовки графика", errorText);
   }
@@ -212,6 +455,8 @@ void GraphView::SetXBeginError(const QString& errorText) {
 void GraphView::SetXEndError(const QString& errorText) {
   ResetResult();
   _ui->xMaxEdit->setStyleSheet("border: 1px solid red; color: red;");
+  Render();
+
   if (!errorText.isEmpty()) {
     QMessageBox::critical(0, "Ошибка отрисовки графика", errorText);
   }
@@ -220,6 +465,8 @@ void GraphView::SetXEndError(const QString& errorText) {
 void GraphView::SetYBeginError(const QString& errorText) {
   ResetResult();
   _ui->yMinEdit->setStyleSheet("border: 1px solid red; color: red;");
+  Render();
+
   if (!errorText.isEmpty()) {
     QMessageBox::critical(0, "Ошибка отрисовки графика", errorText);
   }
@@ -228,6 +475,28 @@ void GraphView::SetYBeginError(const QString& errorText) {
 void GraphView::SetYEndError(const QString& errorText) {
   ResetResult();
   _ui->yMaxEdit->setStyleSheet("border: 1px solid red; color: red;");
+  Render();
+
+  if (!errorText.isEmpty()) {
+    QMessageBox::critical(0, "Ошибка отрисовки графика", errorText);
+  }
+}
+
+void GraphView::SetTBeginError(const QString& errorText) {
+  ResetResult();
+  _ui->tMinEdit->setStyleSheet("border: 1px solid red; color: red;");
+  Render();
+
+  if (!errorText.isEmpty()) {
+    QMessageBox::critical(0, "Ошибка отрисовки графика", errorText);
+  }
+}
+
+void GraphView::SetTEndError(const QString& errorText) {
+  ResetResult();
+  _ui->tMaxEdit->setStyleSheet("border: 1px solid red; color: red;");
+  Render();
+
   if (!errorText.isEmpty()) {
     QMessageBox::critical(0, "Ошибка отрисовки графика", errorText);
   }
@@ -241,11 +510,17 @@ void GraphView::ResetYBeginError() { _ui->yMinEdit->setStyleSheet(""); }
 
 void GraphView::ResetYEndError() { _ui->yMaxEdit->setStyleSheet(""); }
 
+void GraphView::ResetTBeginError() { _ui->tMinEdit->setStyleSheet(""); }
+
+void GraphView::ResetTEndError() { _ui->tMaxEdit->setStyleSheet(""); }
+
 void GraphView::ResetAllErrors() {
   ResetXBeginError();
   ResetXEndError();
   ResetYBeginError();
   ResetYEndError();
+  ResetTBeginError();
+  ResetTEndError();
 }
 
 void GraphView::BackButtonHandle() { close(); }
@@ -5,6 +5,8 @@
 #ifndef SMARTCALCV2_GRAPHVIEW_H
 #define SMARTCALCV2_GRAPHVIEW_H
 #include <QDialog>
+#include <QPen>
+#include <QVector>
 
 #include "../interfaces/IGraphController.h"
 #include "../interfaces/IGraphModelPublic.h"
@@ -14,6 +16,10 @@ namespace Ui {
 class GraphView;
 }
 
+class QCPColorMap;
+class QCPCurve;
+class QCPGraph;
+
 namespace s21 {
 
 class GraphView final : public QDialog,
@@ -38,8 +44,18 @@ class GraphView final : public QDialog,
  private:
   void SetupButtons();
   void GraphPlotConfig(double beginX, double endX, double beginY, double endY);
+  void Render();
+  void UpdateInputFields(double beginX, double endX, double beginY,
+                         double endY);
   void UpdateInputFieldsFromModel();
-  void UpdateResultFromModel();
+  void UpdateResultFromModel(const GraphResult& result);
+  static QPen CurvePen(const GraphCurve& curve);
+  void UpdateCurve(QCPGraph* graph, const GraphCurve& curve,
+                   const GraphResult& result);
+  void UpdateContour(QCPCurve* contour, const GraphCurve& curve);
+  void UpdateGrid(const GraphResult& result);
+  void UpdateMarkers(const GraphResult& result);
+  void RemoveGrid();
   void ResetResult();
   void ResetInputFields();
   void Draw();
@@ -47,17 +63,40 @@ class GraphView final : public QDialog,
   void SetXEndError(const QString& error);
   void SetYBeginError(const QString& error);
   void SetYEndError(const QString& error);
+  void SetTBeginError(const QString& error);
+  void SetTEndError(const QString& error);
   void ResetXBeginError();
   void ResetXEndError();
   void ResetYBeginError();
   void ResetYEndError();
+  void ResetTBeginError();
+  void ResetTEndError();
   void ResetAllErrors();
 
   Ui::GraphView* _ui;
   IGraphController* _controller;
   IGraphModelPublic* _model;
+  // По одному графику на функцию, разрывы задаются точками со значением NaN
+  QVector<QCPGraph*> _graphs;
+  // Кривые, точки которых не упорядочены по X, например линии уровня
+  QVector<QCPCurve*> _contours;
+  // Тепловая карта, существует только пока на графике есть сетка значений
+  QCPColorMap* _colorMap = nullptr;
+  // Особые точки без линий, по одному графику на вид точки
+  QVector<QCPGraph*> _markers;
+  // Что изменилось с последней отрисовки: диапазоны осей и/или данные
+  bool _axesDirty = false;
+  bool _dataDirty = false;
+
+ signals:
+  // Уведомления модели приходят из рабочего потока расчета графика и
+  // доставляются в поток интерфейса через очередь сигналов
+  void GraphUpdated();
+  void GraphFailed(const QString& type, const QString& text);
 
  private slots:
+  void GraphUpdatedHandle();
+  void GraphFailedHandle(const QString& type, const QString& text);
   void BackButtonHandle();
   void DrawButtonHandle();
   void DefaultSettingsButtonHandle();
@@ -42,6 +42,12 @@ void MathView::Update() {
   } else {
     SetCalcResult("");
   }
+
+  if (_model->IsIntegrated()) {
+    SetIntegral(_model->GetIntegral());
+  } else {
+    SetRoots(_model->GetRoots());
+  }
   
   _ui->srcInput->setFocus();
   QTextCursor cursor = _ui->srcInput->textCursor();
@@ -50,23 +56,36 @@ void MathView::Update() {
 }
 
 void MathView::Error(const std::pair<std::string, std::string>& error) {
-  auto errorText = QString::fromStdString(error.second);
-  if (error.first == "input") {
-    SetInputValueError(errorText);
-  } else if (error.first == "wrong_operator") {
-    QMessageBox::critical(0, "Ошибка", errorText);
-  } else if (error.first == "graphCalculation") {
-    SetInputValueError(errorText);
+  emit ErrorReceived(QString::fromStdString(error.first),
+                     QString::fromStdString(error.second));
+}
+
+void MathView::HandleError(const QString& type, const QString& text) {
+  if (type == "input") {
+    SetInputValueError(text);
+  } else if (type == "wrong_operator") {
+    QMessageBox::critical(0, "Ошибка", text);
+  } else if (type == "graphCalculation") {
+    SetInputValueError(text);
+  } else if (type == "solve_range") {
+    SetSolveRangeError(text);
   } else {
-    QMessageBox::critical(0, "Неизвестная ошибка", errorText);
+    QMessageBox::critical(0, "Неизвестная ошибка", text);
   }
 }
 
 void MathView::SetupButtons() {
+  connect(this, SIGNAL(ErrorReceived(QString, QString)), this,
+          SLOT(HandleError(QString, QString)));
+
   // Слот для всех кнопок в калькуляторе
   connect(_ui->calcButton, SIGNAL(clicked()), this, SLOT(HandleCalcButton()));
   connect(_ui->graphButton, SIGNAL(clicked()), this,
           SLOT(HandleGraphButton()));
+  connect(_ui->solveButton, SIGNAL(clicked()), this,
+          SLOT(HandleSolveButton()));
+  connect(_ui->integrateButton, SIGNAL(clicked()), this,
+          SLOT(HandleIntegrateButton()));
   connect(_ui->modButton, SIGNAL(clicked()), this, SLOT(HandleButtonMod()));
   connect(_ui->divButton, SIGNAL(clicked()), this, SLOT(HandleButtonDiv()));
   connect(_ui->mulButton, SIGNAL(clicked()), this, SLOT(HandleButtonMul()));
@@ -115,6 +134,10 @@ void MathView::SetupButtons() {
   // Слоты для обработки изменений в текстовых полях калькулятора
   connect(_ui->xEdit, SIGNAL(textChanged(QString)), this,
           SLOT(HandleXEditChanged()));
+  connect(_ui->aEdit, SIGNAL(textChanged(QString)), this,
+          SLOT(HandleSolveRangeChanged()));
+  connect(_ui->bEdit, SIGNAL(textChanged(QString)), this,
+          SLOT(HandleSolveRangeChanged()));
   connect(_ui->srcInput, SIGNAL(textChanged()), this,
           SLOT(HandleInputChanged()));
 }
@@ -131,6 +154,28 @@ void MathView::SetCalcResult(const QString& result) {
   _ui->resultEdit->setText(result);
 }
 
+void MathView::SetRoots(const std::vector<EquationRoot>& roots) {
+  QStringList lines;
+
+  for (const EquationRoot& root : roots) {
+    lines.append("x = " + QString::number(root.x, 'g', 15) +
+                 "    f(x) = " + QString::number(root.residual, 'g', 3));
+  }
+
+  _ui->rootsOutput->setPlainText(lines.join('\n'));
+}
+
+void MathView::SetIntegral(const IntegralResult& integral) {
+  QString text = "∫ f(x) dx = " + QString::number(integral.value, 'g', 15) +
+                 " ± " + QString::number(integral.error, 'g', 2);
+
+  if (!integral.converged) {
+    text += "\nТочность не достигнута, интеграл может расходиться";
+  }
+
+  _ui->rootsOutput->setPlainText(text);
+}
+
 void MathView::SetXValueError(const QString& errorText) {
   SetCalcResult("ERROR");
   _ui->xEdit->setStyleSheet("border: 1px solid red; color: red;");
@@ -143,13 +188,25 @@ void MathView::SetInputValueError(const QString& errorText) {
   QMessageBox::critical(0, "Ошибка", errorText);
 }
 
+void MathView::SetSolveRangeError(const QString& errorText) {
+  _ui->aEdit->setStyleSheet("border: 1px solid red; color: red;");
+  _ui->bEdit->setStyleSheet("border: 1px solid red; color: red;");
+  QMessageBox::critical(0, "Ошибка", errorText);
+}
+
 void MathView::ResetXValueError() { _ui->xEdit->setStyleSheet(""); }
 
 void MathView::ResetInputValueError() { _ui->srcInput->setStyleSheet(""); }
 
+void MathView::ResetSolveRangeError() {
+  _ui->aEdit->setStyleSheet("");
+  _ui->bEdit->setStyleSheet("");
+}
+
 void MathView::ResetAllErrors() {
   ResetXValueError();
   ResetInputValueError();
+  ResetSolveRangeError();
 }
 
 void MathView::HandleCalcButton() {
@@ -174,6 +231,41 @@ void MathView::HandleCalcButton() {
   }
 }
 
+void MathView::HandleSolveButton() {
+  ResetAllErrors();
+
+  if (ReadSolveRange()) {
+    _controller->Solve();
+  }
+}
+
+void MathView::HandleIntegrateButton() {
+  ResetAllErrors();
+
+  if (ReadSolveRange()) {
+    _controller->Integrate();
+  }
+}
+
+bool MathView::ReadSolveRange() {
+  bool aConvertOk;
+  bool bConvertOk;
+  double aValue = _ui->aEdit->text().replace(",", ".").toDouble(&aConvertOk);
+  double bValue = _ui->bEdit->text().replace(",", ".").toDouble(&bConvertOk);
+
+  _controller->SetExpression(GetViewMathExpression());
+
+  if (!aConvertOk || !bConvertOk) {
+    SetSolveRangeError(
+        "Поля \"a =\" и \"b =\" содержат некорректное значение!");
+    return false;
+  }
+
+  _controller->SetSolveBegin(aValue);
+  _controller->SetSolveEnd(bValue);
+  return true;
+}
+
 void MathView::HandleGraphButton() {
   _controller->SetExpression(GetViewMathExpression());
   _graphView->UpdateGraphWindow(GetViewMathExpression());
@@ -373,6 +465,8 @@ void MathView::HandleButtonRadDeg() {
 
 void MathView::HandleXEditChanged() { ResetXValueError(); }
 
+void MathView::HandleSolveRangeChanged() { ResetSolveRangeError(); }
+
 void MathView::HandleInputChanged() {
   ResetInputValueError();
   SetCalcResult("");
@@ -6,6 +6,7 @@
 #define SMARTCALCV2_MATHVIEW_H
 
 #include <QWidget>
+#include <vector>
 
 #include "../interfaces/IMathController.h"
 #include "../interfaces/IMathModelPublic.h"
@@ -43,10 +44,15 @@ class MathView final : public QWidget,
   QString GetViewMathExpression();
   void SetCalcResult(double result);
   void SetCalcResult(const QString& result);
+  void SetRoots(const std::vector<EquationRoot>& roots);
+  void SetIntegral(const IntegralResult& integral);
+  bool ReadSolveRange();
   void SetXValueError(const QString& error_text);
   void SetInputValueError(const QString& error_text);
+  void SetSolveRangeError(const QString& error_text);
   void ResetXValueError();
   void ResetInputValueError();
+  void ResetSolveRangeError();
   void ResetAllErrors();
 
   Ui::MathView* _ui;
@@ -54,9 +60,17 @@ class MathView final : public QWidget,
   IMathModelPublic* _model;
   GraphView* _graphView;
 
+ signals:
+  // Ошибки графика приходят из рабочего потока, ошибки калькулятора - из
+  // потока интерфейса. Соединение Qt::AutoConnection обрабатывает оба случая
+  void ErrorReceived(const QString& type, const QString& text);
+
  private slots:
+  void HandleError(const QString& type, const QString& text);
   void HandleCalcButton();
   void HandleGraphButton();
+  void HandleSolveButton();
+  void HandleIntegrateButton();
 
   void HandleClearButton();
   void HandlePointButton();
@@ -97,6 +111,7 @@ class MathView final : public QWidget,
 
 
   void HandleXEditChanged();
+  void HandleSolveRangeChanged();
   void HandleInputChanged();
   void HandleButtonFactorial();
   void HandleButtonRadDeg();